@@ -41,6 +41,10 @@ py::class_<DynCtc, pyDynCtc> export_DynCtc(py::module& m)
       DYNCTC_VOID_SET_FAST_MODE_BOOL,
       "fast_mode"_a=true)
 
+    .def("set_incremental_mode", &DynCtc::set_incremental_mode,
+      DYNCTC_VOID_SET_INCREMENTAL_MODE_BOOL,
+      "incremental"_a=true)
+
     .def("restrict_tdomain", &DynCtc::restrict_tdomain,
       DYNCTC_VOID_RESTRICT_TDOMAIN_INTERVAL,
       "tdomain"_a)
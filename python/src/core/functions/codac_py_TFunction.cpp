@@ -134,9 +134,30 @@ void export_TFunction(py::module& m, py::class_<TFnc>& fnc)
       TFUNCTION_CONSTINTERVALVECTOR_EVAL_VECTOR_INTERVAL_TUBEVECTOR,
       "t"_a, "x"_a)
 
+    .def("eval_vector", (const std::vector<IntervalVector> (TFunction::*)(const std::vector<IntervalVector>&) const)&TFunction::eval_vector,
+      TFUNCTION_CONSTVECTORINTERVALVECTOR_EVAL_VECTOR_VECTORINTERVALVECTOR,
+      "v_x"_a)
+
     .def("diff", &TFunction::diff,
       TFUNCTION_CONSTTFUNCTION_DIFF)
 
+    .def("jacobian", &TFunction::jacobian,
+      TFUNCTION_CONSTINTERVALMATRIX_JACOBIAN_INTERVALVECTOR,
+      "x"_a)
+
+    .def("compile", &TFunction::compile,
+      TFUNCTION_VOID_COMPILE)
+
+    .def("is_compiled", &TFunction::is_compiled,
+      TFUNCTION_BOOL_IS_COMPILED)
+
+    .def("set_nb_threads", &TFunction::set_nb_threads,
+      TFUNCTION_VOID_SET_NB_THREADS_INT,
+      "nb_threads"_a)
+
+    .def("nb_threads", &TFunction::nb_threads,
+      TFUNCTION_INT_NB_THREADS)
+
   // Python vector methods
 
     .def("__getitem__", [](TFunction& s, size_t index)
@@ -72,6 +72,12 @@ void export_Trajectory(py::module& m)
     .def("sampled_map", &Trajectory::sampled_map,
       TRAJECTORY_CONSTMAPDOUBLEDOUBLE_SAMPLED_MAP)
 
+    .def("sampled_times", &Trajectory::sampled_times,
+      TRAJECTORY_CONSTVECTORDOUBLE_SAMPLED_TIMES)
+
+    .def("sampled_values", &Trajectory::sampled_values,
+      TRAJECTORY_CONSTVECTORDOUBLE_SAMPLED_VALUES)
+
     .def("tfunction", &Trajectory::tfunction,
       TRAJECTORY_CONSTTFUNCTION_TFUNCTION,
       py::return_value_policy::reference_internal)
@@ -127,6 +133,10 @@ void export_Trajectory(py::module& m)
     .def("make_continuous", (Trajectory & (Trajectory::*)())&Trajectory::make_continuous,
         TRAJECTORY_TRAJECTORY_MAKE_CONTINUOUS)
 
+    .def("limit_history", &Trajectory::limit_history,
+        TRAJECTORY_TRAJECTORY_LIMIT_HISTORY_INT,
+        "nb_samples"_a)
+
   // Integration
 
     .def("primitive", (const Trajectory (Trajectory::*)(double) const)&Trajectory::primitive,
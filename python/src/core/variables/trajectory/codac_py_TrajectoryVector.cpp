@@ -189,6 +189,10 @@ void export_TrajectoryVector(py::module& m)
     .def("sample", (TrajectoryVector & (TrajectoryVector::*)(const TrajectoryVector &))&TrajectoryVector::sample,
       TRAJECTORYVECTOR_TRAJECTORYVECTOR_SAMPLE_TRAJECTORYVECTOR,
       "x"_a)
+
+    .def("limit_history", &TrajectoryVector::limit_history,
+      TRAJECTORYVECTOR_TRAJECTORYVECTOR_LIMIT_HISTORY_INT,
+      "nb_samples"_a)
   
   // Integration
 
@@ -0,0 +1,325 @@
+/**
+ *  IntervalArray class, and interval kernels on arrays
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <cassert>
+#include <cfenv>
+#include <cmath>
+#include <utility>
+#include "codac_IntervalArray.h"
+
+// Note: the kernels are enabled (CODAC_INTERVAL_KERNELS) only if this file is
+// compiled with -frounding-math (see CMakeLists.txt), so that the compiler does
+// not simplify the expressions of the bounds below, that are only valid in the
+// upward rounding mode. With -fno-trapping-math, the selections of bounds
+// (min, max) do not prevent the vectorization. Otherwise, the elements are
+// evaluated by the IBEX functions.
+
+using namespace std;
+using namespace ibex;
+
+namespace codac
+{
+  IntervalArray::IntervalArray(int n)
+    : m_lb(n, NEG_INFINITY), m_ub(n, POS_INFINITY)
+  {
+    assert(n >= 0);
+  }
+
+  int IntervalArray::size() const
+  {
+    return (int)m_lb.size();
+  }
+
+  const Interval IntervalArray::operator[](int i) const
+  {
+    assert(i >= 0 && i < size());
+    if(m_lb[i] <= m_ub[i]) // false for empty elements
+      return Interval(m_lb[i], m_ub[i]);
+    return Interval::EMPTY_SET;
+  }
+
+  void IntervalArray::set(int i, const Interval& x)
+  {
+    assert(i >= 0 && i < size());
+    m_lb[i] = x.is_empty() ? POS_INFINITY : x.lb();
+    m_ub[i] = x.is_empty() ? NEG_INFINITY : x.ub();
+  }
+
+  const double* IntervalArray::lb() const
+  {
+    return m_lb.data();
+  }
+
+  double* IntervalArray::lb()
+  {
+    return m_lb.data();
+  }
+
+  const double* IntervalArray::ub() const
+  {
+    return m_ub.data();
+  }
+
+  double* IntervalArray::ub()
+  {
+    return m_ub.data();
+  }
+
+  namespace
+  {
+    // Sets the upward rounding mode, restored at the end of the scope.
+    // A lower bound is then rounded down by computing the opposite of the
+    // upward rounded opposite: down(a+b) = -up((-a)-b)
+    class UpwardRounding
+    {
+      public:
+
+        UpwardRounding() : m_mode(fegetround())
+        {
+          fesetround(FE_UPWARD);
+        }
+
+        ~UpwardRounding()
+        {
+          fesetround(m_mode);
+        }
+
+      protected:
+
+        int m_mode;
+    };
+
+    // Operand of a kernel: the bounds of an array
+    struct ArrayOperand
+    {
+      explicit ArrayOperand(const IntervalArray& x) : x(x), l(x.lb()), u(x.ub()) { }
+      double lb(int i) const { return l[i]; }
+      double ub(int i) const { return u[i]; }
+      const Interval operator[](int i) const { return x[i]; }
+
+      const IntervalArray& x;
+      const double *l, *u;
+    };
+
+    // Operand of a kernel: one interval, the same for each element
+    struct ScalarOperand
+    {
+      explicit ScalarOperand(const Interval& x)
+        : x(x), l(x.is_empty() ? POS_INFINITY : x.lb()), u(x.is_empty() ? NEG_INFINITY : x.ub()) { }
+      double lb(int) const { return l; }
+      double ub(int) const { return u; }
+      const Interval operator[](int) const { return x; }
+
+      const Interval x;
+      const double l, u;
+    };
+
+    // Elements handled by the kernels: non-empty and bounded (NaN bounds excluded)
+    inline bool regular(double l, double u)
+    {
+      return l > NEG_INFINITY && u < POS_INFINITY && l <= u;
+    }
+
+    // Computes x = f(x) in place by the IBEX function f_ibex, for each element
+    template<typename Ibex>
+    void eval_unary_ibex(IntervalArray& x, const Ibex& f_ibex)
+    {
+      for(int i = 0 ; i < x.size() ; i++)
+        x.set(i, f_ibex(x[i]));
+    }
+
+    // Computes y = f(x1,x2) by the kernel for the elements accepted by is_fast(),
+    // and by the IBEX function f_ibex for the other ones. The kernel writes the
+    // bounds of an element after having read its operands: y can be x1 or x2.
+    template<typename X1, typename X2, typename Fast, typename Kernel, typename Ibex>
+    void eval_binary(const X1& x1, const X2& x2, IntervalArray& y,
+      const Fast& is_fast, const Kernel& kernel, const Ibex& f_ibex)
+    {
+      const int n = y.size();
+
+      #ifndef CODAC_INTERVAL_KERNELS // IBEX functions only
+        for(int i = 0 ; i < n ; i++)
+          y.set(i, f_ibex(x1[i], x2[i]));
+
+      #else
+      vector<pair<int,Interval> > v_ibex; // evaluated before y is written
+      for(int i = 0 ; i < n ; i++)
+        if(!is_fast(x1.lb(i), x1.ub(i), x2.lb(i), x2.ub(i)))
+          v_ibex.push_back(make_pair(i, f_ibex(x1[i], x2[i])));
+
+      {
+        UpwardRounding rounding;
+        double *lb = y.lb(), *ub = y.ub();
+        for(int i = 0 ; i < n ; i++)
+          kernel(x1.lb(i), x1.ub(i), x2.lb(i), x2.ub(i), lb[i], ub[i]);
+      }
+
+      for(const auto& p : v_ibex)
+        y.set(p.first, p.second);
+      #endif
+    }
+
+    // Same as eval_binary(), for unary functions computed in place
+    template<typename Fast, typename Kernel, typename Ibex>
+    void eval_unary(IntervalArray& x,
+      const Fast& is_fast, const Kernel& kernel, const Ibex& f_ibex)
+    {
+      #ifndef CODAC_INTERVAL_KERNELS // IBEX functions only
+        eval_unary_ibex(x, f_ibex);
+
+      #else
+      const int n = x.size();
+      vector<pair<int,Interval> > v_ibex;
+      for(int i = 0 ; i < n ; i++)
+        if(!is_fast(x.lb()[i], x.ub()[i]))
+          v_ibex.push_back(make_pair(i, f_ibex(x[i])));
+
+      {
+        UpwardRounding rounding;
+        double *lb = x.lb(), *ub = x.ub();
+        for(int i = 0 ; i < n ; i++)
+          kernel(lb[i], ub[i], lb[i], ub[i]);
+      }
+
+      for(const auto& p : v_ibex)
+        x.set(p.first, p.second);
+      #endif
+    }
+
+    // Bounds of the elementwise operations, in the upward rounding mode
+    // (function objects, so that they are inlined in the loops)
+
+    struct FastArith
+    {
+      bool operator()(double a, double b, double c, double d) const
+      {
+        return regular(a, b) && regular(c, d);
+      }
+    };
+
+    struct FastDiv
+    {
+      bool operator()(double a, double b, double c, double d) const
+      {
+        return regular(a, b) && regular(c, d) && (c > 0. || d < 0.);
+      }
+    };
+
+    struct KernelAdd
+    {
+      void operator()(double a, double b, double c, double d, double& lb, double& ub) const
+      {
+        lb = -((-a) - c);
+        ub = b + d;
+      }
+    };
+
+    struct KernelSub
+    {
+      void operator()(double a, double b, double c, double d, double& lb, double& ub) const
+      {
+        lb = -(d - a);
+        ub = b - c;
+      }
+    };
+
+    struct KernelMul
+    {
+      void operator()(double a, double b, double c, double d, double& lb, double& ub) const
+      {
+        lb = -std::max(std::max((-a) * c, (-a) * d), std::max((-b) * c, (-b) * d));
+        ub = std::max(std::max(a * c, a * d), std::max(b * c, b * d));
+      }
+    };
+
+    struct KernelDiv
+    {
+      void operator()(double a, double b, double c, double d, double& lb, double& ub) const
+      {
+        lb = -std::max(std::max((-a) / c, (-a) / d), std::max((-b) / c, (-b) / d));
+        ub = std::max(std::max(a / c, a / d), std::max(b / c, b / d));
+      }
+    };
+  }
+
+  #define macro_array_binary(f, kernel, is_fast) \
+    \
+    IntervalArray f(IntervalArray&& x1, const IntervalArray& x2) \
+    { \
+      assert(x1.size() == x2.size()); \
+      eval_binary(ArrayOperand(x1), ArrayOperand(x2), x1, is_fast, kernel, \
+        [](const Interval& y1, const Interval& y2) { return ibex::f(y1, y2); }); \
+      return std::move(x1); \
+    } \
+    \
+    IntervalArray f(IntervalArray&& x1, const Interval& x2) \
+    { \
+      eval_binary(ArrayOperand(x1), ScalarOperand(x2), x1, is_fast, kernel, \
+        [](const Interval& y1, const Interval& y2) { return ibex::f(y1, y2); }); \
+      return std::move(x1); \
+    } \
+    \
+    IntervalArray f(const Interval& x1, IntervalArray&& x2) \
+    { \
+      eval_binary(ScalarOperand(x1), ArrayOperand(x2), x2, is_fast, kernel, \
+        [](const Interval& y1, const Interval& y2) { return ibex::f(y1, y2); }); \
+      return std::move(x2); \
+    } \
+    \
+
+  macro_array_binary(operator+, KernelAdd(), FastArith());
+  macro_array_binary(operator-, KernelSub(), FastArith());
+  macro_array_binary(operator*, KernelMul(), FastArith());
+  macro_array_binary(operator/, KernelDiv(), FastDiv());
+
+  IntervalArray sqr(IntervalArray&& x)
+  {
+    eval_unary(x,
+      [](double a, double b) { return regular(a, b); },
+      [](double a, double b, double& lb, double& ub)
+      {
+        double m = std::max(0., std::max(a, -b)); // smallest magnitude
+        double M = std::max(-a, b); // largest magnitude
+        lb = -((-m) * m);
+        ub = M * M;
+      },
+      [](const Interval& y) { return ibex::sqr(y); });
+    return std::move(x);
+  }
+
+  IntervalArray sqrt(IntervalArray&& x)
+  {
+    eval_unary(x,
+      [](double a, double b) { return regular(a, b) && a >= 0.; },
+      [](double a, double b, double& lb, double& ub)
+      {
+        double s = std::sqrt(a); // rounded up: if inexact, the lower bound is its predecessor
+        double s_prev = -((-s) + s * 1.1102230246251565e-16); // 2^-53
+        lb = s * s > a ? s_prev : s;
+        ub = std::sqrt(b);
+      },
+      [](const Interval& y) { return ibex::sqrt(y); });
+    return std::move(x);
+  }
+
+  #define macro_array_unary_ibex(f) \
+    \
+    IntervalArray f(IntervalArray&& x) \
+    { \
+      eval_unary_ibex(x, [](const Interval& y) { return ibex::f(y); }); \
+      return std::move(x); \
+    } \
+    \
+
+  macro_array_unary_ibex(exp);
+  macro_array_unary_ibex(log);
+  macro_array_unary_ibex(sin);
+  macro_array_unary_ibex(cos);
+}
@@ -0,0 +1,271 @@
+/**
+ *  \file
+ *  IntervalArray class, and interval kernels on arrays
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_INTERVALARRAY_H__
+#define __CODAC_INTERVALARRAY_H__
+
+#include <vector>
+#include "codac_Interval.h"
+
+namespace codac
+{
+  /**
+   * \class IntervalArray
+   * \brief Array of intervals stored as two contiguous arrays of bounds
+   *
+   * This storage (structure of arrays) is the one of the interval kernels below:
+   * \f$+,-,\times,/\f$, \f$\mathrm{sqr}\f$ and \f$\sqrt{\cdot}\f$ compute a whole
+   * array in a loop without branches, vectorized by the compiler. Bounds are rounded
+   * outward (directed rounding mode of the processor). Elements that are empty,
+   * unbounded, or outside the domain handled by a kernel (e.g. divisions by
+   * intervals containing zero) are evaluated by the IBEX functions instead.
+   *
+   * \note Results of the kernels are the tightest floating-point enclosures.
+   *       \f$\exp\f$, \f$\log\f$, \f$\sin\f$ and \f$\cos\f$ are evaluated by the
+   *       IBEX functions for each element, as the ones of the C library are not
+   *       correctly rounded. If the compiler does not support the required flags
+   *       (see CMakeLists.txt), all the elements are evaluated by IBEX.
+   */
+  class IntervalArray
+  {
+    public:
+
+      /**
+       * \brief Creates an array of n intervals, initialized to \f$[-\infty,\infty]\f$
+       *
+       * \param n number of elements
+       */
+      explicit IntervalArray(int n = 0);
+
+      /**
+       * \brief Returns the number of elements
+       *
+       * \return the size of the array
+       */
+      int size() const;
+
+      /**
+       * \brief Returns the i-th element
+       *
+       * \param i index of the element
+       * \return the interval value
+       */
+      const Interval operator[](int i) const;
+
+      /**
+       * \brief Sets the i-th element
+       *
+       * \param i index of the element
+       * \param x the interval value
+       */
+      void set(int i, const Interval& x);
+
+      /**
+       * \brief Returns the array of lower bounds
+       *
+       * \note An empty element has lower bound \f$+\infty\f$ and upper bound \f$-\infty\f$
+       *
+       * \return a pointer to the first lower bound
+       */
+      const double* lb() const;
+
+      /**
+       * \brief Returns the array of lower bounds, for writing
+       *
+       * \return a pointer to the first lower bound
+       */
+      double* lb();
+
+      /**
+       * \brief Returns the array of upper bounds
+       *
+       * \return a pointer to the first upper bound
+       */
+      const double* ub() const;
+
+      /**
+       * \brief Returns the array of upper bounds, for writing
+       *
+       * \return a pointer to the first upper bound
+       */
+      double* ub();
+
+    protected:
+
+      // Class variables:
+
+        std::vector<double> m_lb; //!< lower bounds
+        std::vector<double> m_ub; //!< upper bounds
+  };
+
+  /// \name Interval kernels, computed in place in the array operands
+  /// @{
+
+  /**
+   * \brief \f$[x_1]+[x_2]\f$, elementwise
+   *
+   * \param x1 first operand
+   * \param x2 second operand, of same size
+   * \return the array of the sums
+   */
+  IntervalArray operator+(IntervalArray&& x1, const IntervalArray& x2);
+
+  /**
+   * \brief \f$[x_1]+[x_2]\f$, for each element of \f$[x_1]\f$
+   *
+   * \param x1 array operand
+   * \param x2 interval operand
+   * \return the array of the sums
+   */
+  IntervalArray operator+(IntervalArray&& x1, const Interval& x2);
+
+  /**
+   * \brief \f$[x_1]+[x_2]\f$, for each element of \f$[x_2]\f$
+   *
+   * \param x1 interval operand
+   * \param x2 array operand
+   * \return the array of the sums
+   */
+  IntervalArray operator+(const Interval& x1, IntervalArray&& x2);
+
+  /**
+   * \brief \f$[x_1]-[x_2]\f$, elementwise
+   *
+   * \param x1 first operand
+   * \param x2 second operand, of same size
+   * \return the array of the differences
+   */
+  IntervalArray operator-(IntervalArray&& x1, const IntervalArray& x2);
+
+  /**
+   * \brief \f$[x_1]-[x_2]\f$, for each element of \f$[x_1]\f$
+   *
+   * \param x1 array operand
+   * \param x2 interval operand
+   * \return the array of the differences
+   */
+  IntervalArray operator-(IntervalArray&& x1, const Interval& x2);
+
+  /**
+   * \brief \f$[x_1]-[x_2]\f$, for each element of \f$[x_2]\f$
+   *
+   * \param x1 interval operand
+   * \param x2 array operand
+   * \return the array of the differences
+   */
+  IntervalArray operator-(const Interval& x1, IntervalArray&& x2);
+
+  /**
+   * \brief \f$[x_1]\cdot[x_2]\f$, elementwise
+   *
+   * \param x1 first operand
+   * \param x2 second operand, of same size
+   * \return the array of the products
+   */
+  IntervalArray operator*(IntervalArray&& x1, const IntervalArray& x2);
+
+  /**
+   * \brief \f$[x_1]\cdot[x_2]\f$, for each element of \f$[x_1]\f$
+   *
+   * \param x1 array operand
+   * \param x2 interval operand
+   * \return the array of the products
+   */
+  IntervalArray operator*(IntervalArray&& x1, const Interval& x2);
+
+  /**
+   * \brief \f$[x_1]\cdot[x_2]\f$, for each element of \f$[x_2]\f$
+   *
+   * \param x1 interval operand
+   * \param x2 array operand
+   * \return the array of the products
+   */
+  IntervalArray operator*(const Interval& x1, IntervalArray&& x2);
+
+  /**
+   * \brief \f$[x_1]/[x_2]\f$, elementwise
+   *
+   * \param x1 first operand
+   * \param x2 second operand, of same size
+   * \return the array of the quotients
+   */
+  IntervalArray operator/(IntervalArray&& x1, const IntervalArray& x2);
+
+  /**
+   * \brief \f$[x_1]/[x_2]\f$, for each element of \f$[x_1]\f$
+   *
+   * \param x1 array operand
+   * \param x2 interval operand
+   * \return the array of the quotients
+   */
+  IntervalArray operator/(IntervalArray&& x1, const Interval& x2);
+
+  /**
+   * \brief \f$[x_1]/[x_2]\f$, for each element of \f$[x_2]\f$
+   *
+   * \param x1 interval operand
+   * \param x2 array operand
+   * \return the array of the quotients
+   */
+  IntervalArray operator/(const Interval& x1, IntervalArray&& x2);
+
+  /**
+   * \brief \f$[x]^2\f$, elementwise
+   *
+   * \param x array operand
+   * \return the array of the squares
+   */
+  IntervalArray sqr(IntervalArray&& x);
+
+  /**
+   * \brief \f$\sqrt{[x]}\f$, elementwise
+   *
+   * \param x array operand
+   * \return the array of the square roots
+   */
+  IntervalArray sqrt(IntervalArray&& x);
+
+  /**
+   * \brief \f$\exp([x])\f$, elementwise
+   *
+   * \param x array operand
+   * \return the array of the exponentials
+   */
+  IntervalArray exp(IntervalArray&& x);
+
+  /**
+   * \brief \f$\log([x])\f$, elementwise
+   *
+   * \param x array operand
+   * \return the array of the logarithms
+   */
+  IntervalArray log(IntervalArray&& x);
+
+  /**
+   * \brief \f$\sin([x])\f$, elementwise
+   *
+   * \param x array operand
+   * \return the array of the sines
+   */
+  IntervalArray sin(IntervalArray&& x);
+
+  /**
+   * \brief \f$\cos([x])\f$, elementwise
+   *
+   * \param x array operand
+   * \return the array of the cosines
+   */
+  IntervalArray cos(IntervalArray&& x);
+
+  /// @}
+}
+
+#endif
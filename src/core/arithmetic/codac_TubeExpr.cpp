@@ -0,0 +1,316 @@
+/**
+ *  TubeExpr class
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <vector>
+#include "codac_TubeExpr.h"
+#include "codac_Slice.h"
+#include "codac_Exception.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace codac
+{
+  // Nodes of the expression tree, evaluated on the slice k of the reference tube.
+  // When the tubes of the expression have different slicings, k is -1:
+  // their values are then evaluated over t, on the common slicing.
+
+  struct TubeExpr::Node
+  {
+    virtual ~Node() { }
+
+    // Value of the expression over the tdomain t of the slice k
+    virtual const Interval envelope(int k, const Interval& t) const = 0;
+
+    // Value of the expression at the gate k (between 0 and nb_slices), at time t
+    virtual const Interval gate(int k, double t) const = 0;
+
+    // Appends the tubes of the expression to v, in order of appearance
+    virtual void tubes(vector<const Tube*>& v) const = 0;
+  };
+
+  struct TubeNode : public TubeExpr::Node
+  {
+    TubeNode(const Tube& x) : m_x(x) { }
+
+    const Interval envelope(int k, const Interval& t) const
+    {
+      if(k < 0) // t is included in one slice of x
+        return m_x(t);
+      return m_x.slice(k)->codomain();
+    }
+
+    const Interval gate(int k, double t) const
+    {
+      if(k < 0) // value of the gate of x at t, or of its slice if there is no gate
+        return m_x(t);
+      return k < m_x.nb_slices() ? m_x.slice(k)->input_gate() : m_x.last_slice()->output_gate();
+    }
+
+    void tubes(vector<const Tube*>& v) const
+    {
+      v.push_back(&m_x);
+    }
+
+    const Tube& m_x;
+  };
+
+  struct TrajectoryNode : public TubeExpr::Node
+  {
+    TrajectoryNode(const Trajectory& x) : m_x(x) { }
+
+    const Interval envelope(int k, const Interval& t) const
+    {
+      return m_x(t);
+    }
+
+    const Interval gate(int k, double t) const
+    {
+      return m_x(Interval(t));
+    }
+
+    void tubes(vector<const Tube*>& v) const
+    {
+
+    }
+
+    const Trajectory& m_x;
+  };
+
+  struct ConstantNode : public TubeExpr::Node
+  {
+    ConstantNode(const Interval& x) : m_x(x) { }
+
+    const Interval envelope(int k, const Interval& t) const
+    {
+      return m_x;
+    }
+
+    const Interval gate(int k, double t) const
+    {
+      return m_x;
+    }
+
+    void tubes(vector<const Tube*>& v) const
+    {
+
+    }
+
+    const Interval m_x;
+  };
+
+  struct UnaryNode : public TubeExpr::Node
+  {
+    UnaryNode(const shared_ptr<const TubeExpr::Node>& e, const function<Interval(const Interval&)>& f)
+      : m_e(e), m_f(f) { }
+
+    const Interval envelope(int k, const Interval& t) const
+    {
+      return m_f(m_e->envelope(k, t));
+    }
+
+    const Interval gate(int k, double t) const
+    {
+      return m_f(m_e->gate(k, t));
+    }
+
+    void tubes(vector<const Tube*>& v) const
+    {
+      m_e->tubes(v);
+    }
+
+    const shared_ptr<const TubeExpr::Node> m_e;
+    const function<Interval(const Interval&)> m_f;
+  };
+
+  struct BinaryNode : public TubeExpr::Node
+  {
+    BinaryNode(const shared_ptr<const TubeExpr::Node>& e1, const shared_ptr<const TubeExpr::Node>& e2,
+      const function<Interval(const Interval&,const Interval&)>& f)
+      : m_e1(e1), m_e2(e2), m_f(f)
+    {
+
+    }
+
+    const Interval envelope(int k, const Interval& t) const
+    {
+      return m_f(m_e1->envelope(k, t), m_e2->envelope(k, t));
+    }
+
+    const Interval gate(int k, double t) const
+    {
+      return m_f(m_e1->gate(k, t), m_e2->gate(k, t));
+    }
+
+    void tubes(vector<const Tube*>& v) const
+    {
+      m_e1->tubes(v);
+      m_e2->tubes(v);
+    }
+
+    const shared_ptr<const TubeExpr::Node> m_e1, m_e2;
+    const function<Interval(const Interval&,const Interval&)> m_f;
+  };
+
+  // Public methods
+
+    // Definition
+
+    TubeExpr::TubeExpr(const Tube& x)
+      : m_node(make_shared<TubeNode>(x))
+    {
+
+    }
+
+    TubeExpr::TubeExpr(const Trajectory& x)
+      : m_node(make_shared<TrajectoryNode>(x))
+    {
+
+    }
+
+    TubeExpr::TubeExpr(const Interval& x)
+      : m_node(make_shared<ConstantNode>(x))
+    {
+
+    }
+
+    TubeExpr::TubeExpr(const TubeExpr& e, const function<Interval(const Interval&)>& f)
+      : m_node(make_shared<UnaryNode>(e.m_node, f))
+    {
+
+    }
+
+    TubeExpr::TubeExpr(const TubeExpr& e1, const TubeExpr& e2, const function<Interval(const Interval&,const Interval&)>& f)
+      : m_node(make_shared<BinaryNode>(e1.m_node, e2.m_node, f))
+    {
+
+    }
+
+    // Evaluation
+
+    Tube TubeExpr::eval() const
+    {
+      vector<const Tube*> v_tubes;
+      m_node->tubes(v_tubes);
+      if(v_tubes.empty())
+        throw Exception(__func__, "the expression must contain at least one tube");
+
+      const Tube *x = v_tubes[0];
+      bool same_slicing = true;
+      for(const Tube *x_i : v_tubes)
+      {
+        if(x_i->tdomain() != x->tdomain())
+          throw Exception(__func__, "the tubes of the expression must have the same tdomain");
+        same_slicing &= Tube::same_slicing(*x, *x_i);
+      }
+
+      Tube x_resampled; // in case of different slicings, common slicing of the tubes
+      if(!same_slicing)
+      {
+        x_resampled = *x;
+        for(const Tube *x_i : v_tubes)
+          x_resampled.sample(*x_i);
+        x = &x_resampled;
+      }
+
+      const Node *node = m_node.get();
+      int n = x->nb_slices();
+
+      // The slicing of x is copied, and the values are computed in the same pass
+      Tube y;
+      y.copy_slices(*x, y.allocate_slices(n), [node,n,same_slicing](Slice *s, int k)
+      {
+        const Interval t = s->tdomain();
+        int i = same_slicing ? k : -1; // index of the slice in the tubes of the expression
+        s->set_envelope(node->envelope(i, t), false);
+        s->set_input_gate(node->gate(i, t.lb()), false);
+        if(k == n - 1)
+          s->set_output_gate(node->gate(same_slicing ? n : -1, t.ub()), false);
+      });
+
+      return y;
+    }
+
+  // Lazy scalar outputs
+
+  #define macro_expr_unary(f) \
+    \
+    TubeExpr f(const TubeExpr& x) \
+    { \
+      return TubeExpr(x, [](const Interval& y) { return ibex::f(y); }); \
+    } \
+
+  macro_expr_unary(cos);
+  macro_expr_unary(sin);
+  macro_expr_unary(abs);
+  macro_expr_unary(sqr);
+  macro_expr_unary(sqrt);
+  macro_expr_unary(exp);
+  macro_expr_unary(log);
+  macro_expr_unary(tan);
+  macro_expr_unary(acos);
+  macro_expr_unary(asin);
+  macro_expr_unary(atan);
+  macro_expr_unary(cosh);
+  macro_expr_unary(sinh);
+  macro_expr_unary(tanh);
+  macro_expr_unary(acosh);
+  macro_expr_unary(asinh);
+  macro_expr_unary(atanh);
+
+  #define macro_expr_unary_param(f, p) \
+    \
+    TubeExpr f(const TubeExpr& x, p param) \
+    { \
+      return TubeExpr(x, [param](const Interval& y) { return ibex::f(y, param); }); \
+    } \
+
+  macro_expr_unary_param(pow, int);
+  macro_expr_unary_param(pow, double);
+  macro_expr_unary_param(pow, const Interval&);
+  macro_expr_unary_param(root, int);
+
+  #define macro_expr_binary(f) \
+    \
+    TubeExpr f(const TubeExpr& x1, const TubeExpr& x2) \
+    { \
+      return TubeExpr(x1, x2, [](const Interval& y1, const Interval& y2) { return ibex::f(y1, y2); }); \
+    } \
+    \
+    TubeExpr f(const TubeExpr& x1, const Interval& x2) \
+    { \
+      return f(x1, TubeExpr(x2)); \
+    } \
+    \
+    TubeExpr f(const Interval& x1, const TubeExpr& x2) \
+    { \
+      return f(TubeExpr(x1), x2); \
+    } \
+
+  macro_expr_binary(operator+);
+  macro_expr_binary(operator-);
+  macro_expr_binary(operator*);
+  macro_expr_binary(operator/);
+  macro_expr_binary(operator|);
+  macro_expr_binary(operator&);
+  macro_expr_binary(atan2);
+  macro_expr_binary(min);
+  macro_expr_binary(max);
+
+  TubeExpr operator+(const TubeExpr& x)
+  {
+    return x;
+  }
+
+  TubeExpr operator-(const TubeExpr& x)
+  {
+    return TubeExpr(x, [](const Interval& y) { return -y; });
+  }
+}
@@ -0,0 +1,190 @@
+/**
+ *  \file
+ *  TubeExpr class
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_TUBEEXPR_H__
+#define __CODAC_TUBEEXPR_H__
+
+#include <memory>
+#include <functional>
+#include "codac_Interval.h"
+#include "codac_Tube.h"
+#include "codac_Trajectory.h"
+
+namespace codac
+{
+  /**
+   * \class TubeExpr
+   * \brief Lazy arithmetic expression of tubes, trajectories and intervals
+   *
+   * The operators applied on TubeExpr objects only build the expression.
+   * The expression is then evaluated by eval() slice by slice, in a single
+   * pass and without temporary tubes: values of the slices and of the gates
+   * are computed at the same time.
+   *
+   * For instance: `Tube y = (2.*sin(TubeExpr(x)) + sqr(TubeExpr(v)) - z).eval();`
+   *
+   * \note The operands are referenced, not copied: they have to exist
+   *       until the evaluation of the expression. Temporary tubes and
+   *       trajectories are then not accepted as operands.
+   * \note Tubes of different slicings are evaluated on their common slicing,
+   *       as done by the eager operators on tubes.
+   */
+  class TubeExpr
+  {
+    public:
+
+      /**
+       * \brief Creates an expression made of a tube
+       *
+       * \param x the Tube operand, referenced until the evaluation
+       */
+      TubeExpr(const Tube& x);
+
+      /**
+       * \brief Forbids an expression made of a temporary tube, that would not
+       *        exist anymore at the evaluation
+       *
+       * \param x the temporary Tube
+       */
+      TubeExpr(Tube&& x) = delete;
+
+      /**
+       * \brief Creates an expression made of a trajectory
+       *
+       * \param x the Trajectory operand, referenced until the evaluation
+       */
+      TubeExpr(const Trajectory& x);
+
+      /**
+       * \brief Forbids an expression made of a temporary trajectory, that would not
+       *        exist anymore at the evaluation
+       *
+       * \param x the temporary Trajectory
+       */
+      TubeExpr(Trajectory&& x) = delete;
+
+      /**
+       * \brief Creates an expression made of a constant interval
+       *
+       * \param x the Interval value
+       */
+      TubeExpr(const Interval& x);
+
+      /**
+       * \brief Creates the expression \f$f(e)\f$ from an interval function
+       *
+       * \param e the operand expression
+       * \param f the unary interval function
+       */
+      TubeExpr(const TubeExpr& e, const std::function<Interval(const Interval&)>& f);
+
+      /**
+       * \brief Creates the expression \f$f(e_1,e_2)\f$ from an interval function
+       *
+       * \param e1 the first operand expression
+       * \param e2 the second operand expression
+       * \param f the binary interval function
+       */
+      TubeExpr(const TubeExpr& e1, const TubeExpr& e2, const std::function<Interval(const Interval&,const Interval&)>& f);
+
+      /**
+       * \brief Evaluates the expression slice by slice, in one pass
+       *
+       * \note The slicing of the result is the one of the tubes of the expression.
+       *       If their slicings differ, the result is sampled at all their gates,
+       *       and the values of the tubes are then evaluated over the new slices.
+       *       At least one tube is required, and all tubes must share the same tdomain.
+       *
+       * \return the resulting Tube
+       */
+      Tube eval() const;
+
+      /**
+       * \brief Node of the expression tree (defined in the source file)
+       */
+      struct Node;
+
+    protected:
+
+      std::shared_ptr<const Node> m_node; //!< root of the expression tree, shared with the expressions built from this one
+  };
+
+  /// \name Lazy scalar outputs
+  /// @{
+
+    TubeExpr cos(const TubeExpr& x); //!< \f$\cos([x](\cdot))\f$, lazily evaluated
+    TubeExpr sin(const TubeExpr& x); //!< \f$\sin([x](\cdot))\f$, lazily evaluated
+    TubeExpr abs(const TubeExpr& x); //!< \f$\mid[x](\cdot)\mid\f$, lazily evaluated
+    TubeExpr sqr(const TubeExpr& x); //!< \f$[x]^2(\cdot)\f$, lazily evaluated
+    TubeExpr sqrt(const TubeExpr& x); //!< \f$\sqrt{[x](\cdot)}\f$, lazily evaluated
+    TubeExpr exp(const TubeExpr& x); //!< \f$\exp([x](\cdot))\f$, lazily evaluated
+    TubeExpr log(const TubeExpr& x); //!< \f$\log([x](\cdot))\f$, lazily evaluated
+    TubeExpr tan(const TubeExpr& x); //!< \f$\tan([x](\cdot))\f$, lazily evaluated
+    TubeExpr acos(const TubeExpr& x); //!< \f$\arccos([x](\cdot))\f$, lazily evaluated
+    TubeExpr asin(const TubeExpr& x); //!< \f$\arcsin([x](\cdot))\f$, lazily evaluated
+    TubeExpr atan(const TubeExpr& x); //!< \f$\arctan([x](\cdot))\f$, lazily evaluated
+    TubeExpr cosh(const TubeExpr& x); //!< \f$\cosh([x](\cdot))\f$, lazily evaluated
+    TubeExpr sinh(const TubeExpr& x); //!< \f$\sinh([x](\cdot))\f$, lazily evaluated
+    TubeExpr tanh(const TubeExpr& x); //!< \f$\tanh([x](\cdot))\f$, lazily evaluated
+    TubeExpr acosh(const TubeExpr& x); //!< \f$\mathrm{arccosh}([x](\cdot))\f$, lazily evaluated
+    TubeExpr asinh(const TubeExpr& x); //!< \f$\mathrm{arcsinh}([x](\cdot))\f$, lazily evaluated
+    TubeExpr atanh(const TubeExpr& x); //!< \f$\mathrm{arctanh}([x](\cdot))\f$, lazily evaluated
+
+    TubeExpr pow(const TubeExpr& x, int p); //!< \f$[x]^p(\cdot)\f$, lazily evaluated
+    TubeExpr pow(const TubeExpr& x, double p); //!< \f$[x]^p(\cdot)\f$, lazily evaluated
+    TubeExpr pow(const TubeExpr& x, const Interval& p); //!< \f$[x]^{[p]}(\cdot)\f$, lazily evaluated
+    TubeExpr root(const TubeExpr& x, int p); //!< \f$\sqrt[p]{[x](\cdot)}\f$, lazily evaluated
+
+    TubeExpr operator+(const TubeExpr& x); //!< \f$[x](\cdot)\f$, lazily evaluated
+    TubeExpr operator-(const TubeExpr& x); //!< \f$-[x](\cdot)\f$, lazily evaluated
+
+    // Binary operations, also defined with Interval operands so that real values can be used
+
+    TubeExpr atan2(const TubeExpr& x, const TubeExpr& y); //!< \f$\arctan2([x](\cdot),[y](\cdot))\f$, lazily evaluated
+    TubeExpr atan2(const TubeExpr& x, const Interval& y); //!< \f$\arctan2([x](\cdot),[y](\cdot))\f$, lazily evaluated
+    TubeExpr atan2(const Interval& x, const TubeExpr& y); //!< \f$\arctan2([x](\cdot),[y](\cdot))\f$, lazily evaluated
+
+    TubeExpr min(const TubeExpr& x, const TubeExpr& y); //!< \f$\min([x](\cdot),[y](\cdot))\f$, lazily evaluated
+    TubeExpr min(const TubeExpr& x, const Interval& y); //!< \f$\min([x](\cdot),[y](\cdot))\f$, lazily evaluated
+    TubeExpr min(const Interval& x, const TubeExpr& y); //!< \f$\min([x](\cdot),[y](\cdot))\f$, lazily evaluated
+
+    TubeExpr max(const TubeExpr& x, const TubeExpr& y); //!< \f$\max([x](\cdot),[y](\cdot))\f$, lazily evaluated
+    TubeExpr max(const TubeExpr& x, const Interval& y); //!< \f$\max([x](\cdot),[y](\cdot))\f$, lazily evaluated
+    TubeExpr max(const Interval& x, const TubeExpr& y); //!< \f$\max([x](\cdot),[y](\cdot))\f$, lazily evaluated
+
+    TubeExpr operator+(const TubeExpr& x, const TubeExpr& y); //!< \f$[x](\cdot)+[y](\cdot)\f$, lazily evaluated
+    TubeExpr operator+(const TubeExpr& x, const Interval& y); //!< \f$[x](\cdot)+[y](\cdot)\f$, lazily evaluated
+    TubeExpr operator+(const Interval& x, const TubeExpr& y); //!< \f$[x](\cdot)+[y](\cdot)\f$, lazily evaluated
+
+    TubeExpr operator-(const TubeExpr& x, const TubeExpr& y); //!< \f$[x](\cdot)-[y](\cdot)\f$, lazily evaluated
+    TubeExpr operator-(const TubeExpr& x, const Interval& y); //!< \f$[x](\cdot)-[y](\cdot)\f$, lazily evaluated
+    TubeExpr operator-(const Interval& x, const TubeExpr& y); //!< \f$[x](\cdot)-[y](\cdot)\f$, lazily evaluated
+
+    TubeExpr operator*(const TubeExpr& x, const TubeExpr& y); //!< \f$[x](\cdot)\cdot[y](\cdot)\f$, lazily evaluated
+    TubeExpr operator*(const TubeExpr& x, const Interval& y); //!< \f$[x](\cdot)\cdot[y](\cdot)\f$, lazily evaluated
+    TubeExpr operator*(const Interval& x, const TubeExpr& y); //!< \f$[x](\cdot)\cdot[y](\cdot)\f$, lazily evaluated
+
+    TubeExpr operator/(const TubeExpr& x, const TubeExpr& y); //!< \f$[x](\cdot)/[y](\cdot)\f$, lazily evaluated
+    TubeExpr operator/(const TubeExpr& x, const Interval& y); //!< \f$[x](\cdot)/[y](\cdot)\f$, lazily evaluated
+    TubeExpr operator/(const Interval& x, const TubeExpr& y); //!< \f$[x](\cdot)/[y](\cdot)\f$, lazily evaluated
+
+    TubeExpr operator|(const TubeExpr& x, const TubeExpr& y); //!< \f$[x](\cdot)\sqcup[y](\cdot)\f$, lazily evaluated
+    TubeExpr operator|(const TubeExpr& x, const Interval& y); //!< \f$[x](\cdot)\sqcup[y](\cdot)\f$, lazily evaluated
+    TubeExpr operator|(const Interval& x, const TubeExpr& y); //!< \f$[x](\cdot)\sqcup[y](\cdot)\f$, lazily evaluated
+
+    TubeExpr operator&(const TubeExpr& x, const TubeExpr& y); //!< \f$[x](\cdot)\cap[y](\cdot)\f$, lazily evaluated
+    TubeExpr operator&(const TubeExpr& x, const Interval& y); //!< \f$[x](\cdot)\cap[y](\cdot)\f$, lazily evaluated
+    TubeExpr operator&(const Interval& x, const TubeExpr& y); //!< \f$[x](\cdot)\cap[y](\cdot)\f$, lazily evaluated
+
+  /// @}
+}
+
+#endif
@@ -29,103 +29,103 @@ namespace codac
       * \param x
       * \return Tube output
       */
-    const Tube cos(const Tube& x);
+    Tube cos(const Tube& x);
 
     /** \brief \f$\sin([x](\cdot))\f$
       * \param x
       * \return Tube output
       */
-    const Tube sin(const Tube& x);
+    Tube sin(const Tube& x);
 
     /** \brief \f$\mid[x](\cdot)\mid\f$
       * \param x
       * \return Tube output
       */
-    const Tube abs(const Tube& x);
+    Tube abs(const Tube& x);
 
     /** \brief \f$[x]^2(\cdot)\f$
       * \param x
       * \return Tube output
       */
-    const Tube sqr(const Tube& x);
+    Tube sqr(const Tube& x);
 
     /** \brief \f$\sqrt{[x](\cdot)}\f$
       * \param x
       * \return Tube output
       */
-    const Tube sqrt(const Tube& x);
+    Tube sqrt(const Tube& x);
 
     /** \brief \f$\exp([x](\cdot))\f$
       * \param x
       * \return Tube output
       */
-    const Tube exp(const Tube& x);
+    Tube exp(const Tube& x);
 
     /** \brief \f$\log([x](\cdot))\f$
       * \param x
       * \return Tube output
       */
-    const Tube log(const Tube& x);
+    Tube log(const Tube& x);
 
     /** \brief \f$\tan([x](\cdot))\f$
       * \param x
       * \return Tube output
       */
-    const Tube tan(const Tube& x);
+    Tube tan(const Tube& x);
 
     /** \brief \f$\arccos([x](\cdot))\f$
       * \param x
       * \return Tube output
       */
-    const Tube acos(const Tube& x);
+    Tube acos(const Tube& x);
 
     /** \brief \f$\arcsin([x](\cdot))\f$
       * \param x
       * \return Tube output
       */
-    const Tube asin(const Tube& x);
+    Tube asin(const Tube& x);
 
     /** \brief \f$\arctan([x](\cdot))\f$
       * \param x
       * \return Tube output
       */
-    const Tube atan(const Tube& x);
+    Tube atan(const Tube& x);
 
     /** \brief \f$\cosh([x](\cdot))\f$
       * \param x
       * \return Tube output
       */
-    const Tube cosh(const Tube& x);
+    Tube cosh(const Tube& x);
 
     /** \brief \f$\sinh([x](\cdot))\f$
       * \param x
       * \return Tube output
       */
-    const Tube sinh(const Tube& x);
+    Tube sinh(const Tube& x);
 
     /** \brief \f$\tanh([x](\cdot))\f$
       * \param x
       * \return Tube output
       */
-    const Tube tanh(const Tube& x);
+    Tube tanh(const Tube& x);
 
     /** \brief \f$\mathrm{arccosh}([x](\cdot))\f$
       * \param x
       * \return Tube output
       */
-    const Tube acosh(const Tube& x);
+    Tube acosh(const Tube& x);
 
     /** \brief \f$\mathrm{arcsinh}([x](\cdot))\f$
       * \param x
       * \return Tube output
       */
-    const Tube asinh(const Tube& x);
+    Tube asinh(const Tube& x);
 
     /** \brief \f$\mathrm{arctanh}([x](\cdot))\f$
       * \param x
       * \return Tube output
       */
-    const Tube atanh(const Tube& x);
+    Tube atanh(const Tube& x);
 
 
     /** \brief \f$\mathrm{arctan2}([y](\cdot),[x](\cdot))\f$
@@ -133,21 +133,21 @@ namespace codac
       * \param x
       * \return Tube output
       */
-    const Tube atan2(const Tube& y, const Tube& x);
+    Tube atan2(const Tube& y, const Tube& x);
 
     /** \brief \f$\mathrm{arctan2}([y](\cdot),[x])\f$
       * \param y
       * \param x
       * \return Tube output
       */
-    const Tube atan2(const Tube& y, const Interval& x);
+    Tube atan2(const Tube& y, const Interval& x);
 
     /** \brief \f$\mathrm{arctan2}([y],[x](\cdot))\f$
       * \param y
       * \param x
       * \return Tube output
       */
-    const Tube atan2(const Interval& y, const Tube& x);
+    Tube atan2(const Interval& y, const Tube& x);
 
 
     /** \brief \f$[x]^p(\cdot)\f$
@@ -155,28 +155,28 @@ namespace codac
       * \param p
       * \return Tube output
       */
-    const Tube pow(const Tube& x, int p);
+    Tube pow(const Tube& x, int p);
 
     /** \brief \f$[x]^p(\cdot)\f$
       * \param x
       * \param p
       * \return Tube output
       */
-    const Tube pow(const Tube& x, double p);
+    Tube pow(const Tube& x, double p);
 
     /** \brief \f$[x]^{[p]}(\cdot)\f$
       * \param x
       * \param p
       * \return Tube output
       */
-    const Tube pow(const Tube& x, const Interval& p);
+    Tube pow(const Tube& x, const Interval& p);
 
     /** \brief \f$\sqrt[p]{[x](\cdot)}\f$
       * \param x
       * \param p
       * \return Tube output
       */
-    const Tube root(const Tube& x, int p);
+    Tube root(const Tube& x, int p);
 
     // todo: atan2, pow with Trajectory as parameter
 
@@ -185,126 +185,126 @@ namespace codac
       * \param x
       * \return Tube output
       */
-    const Tube min(const Tube& y, const Tube& x);
+    Tube min(const Tube& y, const Tube& x);
 
     /** \brief \f$\mathrm{min}([y](\cdot),[x])\f$
       * \param y
       * \param x
       * \return Tube output
       */
-    const Tube min(const Tube& y, const Interval& x);
+    Tube min(const Tube& y, const Interval& x);
 
     /** \brief \f$\mathrm{min}([y],[x](\cdot))\f$
       * \param y
       * \param x
       * \return Tube output
       */
-    const Tube min(const Interval& y, const Tube& x);
+    Tube min(const Interval& y, const Tube& x);
 
     /** \brief \f$\mathrm{max}([y](\cdot),[x](\cdot))\f$
       * \param y
       * \param x
       * \return Tube output
       */
-    const Tube max(const Tube& y, const Tube& x);
+    Tube max(const Tube& y, const Tube& x);
 
     /** \brief \f$\mathrm{max}([y](\cdot),[x])\f$
       * \param y
       * \param x
       * \return Tube output
       */
-    const Tube max(const Tube& y, const Interval& x);
+    Tube max(const Tube& y, const Interval& x);
 
     /** \brief \f$\mathrm{max}([y],[x](\cdot))\f$
       * \param y
       * \param x
       * \return Tube output
       */
-    const Tube max(const Interval& y, const Tube& x);
+    Tube max(const Interval& y, const Tube& x);
 
 
     /** \brief \f$[x](\cdot)\f$
       * \param x
       * \return Tube output
       */
-    const Tube operator+(const Tube& x);
+    Tube operator+(const Tube& x);
 
     /** \brief \f$[x](\cdot)+[y](\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator+(const Tube& x, const Tube& y);
+    Tube operator+(const Tube& x, const Tube& y);
 
     /** \brief \f$[x](\cdot)+[y]\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator+(const Tube& x, const Interval& y);
+    Tube operator+(const Tube& x, const Interval& y);
 
     /** \brief \f$[x]+[y](\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator+(const Interval& x, const Tube& y);
+    Tube operator+(const Interval& x, const Tube& y);
 
     /** \brief \f$[x](\cdot)+y(\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator+(const Tube& x, const Trajectory& y);
+    Tube operator+(const Tube& x, const Trajectory& y);
 
     /** \brief \f$x(\cdot)+[y](\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator+(const Trajectory& x, const Tube& y);
+    Tube operator+(const Trajectory& x, const Tube& y);
 
 
     /** \brief \f$-[x](\cdot)\f$
       * \param x
       * \return Tube output
       */
-    const Tube operator-(const Tube& x);
+    Tube operator-(const Tube& x);
 
     /** \brief \f$[x](\cdot)-[y](\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator-(const Tube& x, const Tube& y);
+    Tube operator-(const Tube& x, const Tube& y);
 
     /** \brief \f$[x](\cdot)-[y]\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator-(const Tube& x, const Interval& y);
+    Tube operator-(const Tube& x, const Interval& y);
 
     /** \brief \f$[x]-[y](\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator-(const Interval& x, const Tube& y);
+    Tube operator-(const Interval& x, const Tube& y);
 
     /** \brief \f$[x](\cdot)-y(\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator-(const Tube& x, const Trajectory& y);
+    Tube operator-(const Tube& x, const Trajectory& y);
 
     /** \brief \f$x(\cdot)-[y](\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator-(const Trajectory& x, const Tube& y);
+    Tube operator-(const Trajectory& x, const Tube& y);
 
 
     /** \brief \f$[x](\cdot)\cdot[y](\cdot)\f$
@@ -312,35 +312,35 @@ namespace codac
       * \param y
       * \return Tube output
       */
-    const Tube operator*(const Tube& x, const Tube& y);
+    Tube operator*(const Tube& x, const Tube& y);
 
     /** \brief \f$[x](\cdot)\cdot[y]\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator*(const Tube& x, const Interval& y);
+    Tube operator*(const Tube& x, const Interval& y);
 
     /** \brief \f$[x]\cdot[y](\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator*(const Interval& x, const Tube& y);
+    Tube operator*(const Interval& x, const Tube& y);
 
     /** \brief \f$[x](\cdot)\cdot y(\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator*(const Tube& x, const Trajectory& y);
+    Tube operator*(const Tube& x, const Trajectory& y);
 
     /** \brief \f$x(\cdot)\cdot[y](\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator*(const Trajectory& x, const Tube& y);
+    Tube operator*(const Trajectory& x, const Tube& y);
 
 
     /** \brief \f$[x](\cdot)/[y](\cdot)\f$
@@ -348,35 +348,35 @@ namespace codac
       * \param y
       * \return Tube output
       */
-    const Tube operator/(const Tube& x, const Tube& y);
+    Tube operator/(const Tube& x, const Tube& y);
 
     /** \brief \f$[x](\cdot)/[y]\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator/(const Tube& x, const Interval& y);
+    Tube operator/(const Tube& x, const Interval& y);
 
     /** \brief \f$[x]/[y](\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator/(const Interval& x, const Tube& y);
+    Tube operator/(const Interval& x, const Tube& y);
 
     /** \brief \f$[x](\cdot)/y(\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator/(const Tube& x, const Trajectory& y);
+    Tube operator/(const Tube& x, const Trajectory& y);
 
     /** \brief \f$x(\cdot)/[y](\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator/(const Trajectory& x, const Tube& y);
+    Tube operator/(const Trajectory& x, const Tube& y);
 
 
     /** \brief \f$[x](\cdot)\sqcup[y](\cdot)\f$
@@ -384,35 +384,35 @@ namespace codac
       * \param y
       * \return Tube output
       */
-    const Tube operator|(const Tube& x, const Tube& y);
+    Tube operator|(const Tube& x, const Tube& y);
 
     /** \brief \f$[x](\cdot)\sqcup[y]\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator|(const Tube& x, const Interval& y);
+    Tube operator|(const Tube& x, const Interval& y);
 
     /** \brief \f$[x]\sqcup[y](\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator|(const Interval& x, const Tube& y);
+    Tube operator|(const Interval& x, const Tube& y);
 
     /** \brief \f$[x](\cdot)\sqcup y(\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator|(const Tube& x, const Trajectory& y);
+    Tube operator|(const Tube& x, const Trajectory& y);
 
     /** \brief \f$x(\cdot)\sqcup [y](\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator|(const Trajectory& x, const Tube& y);
+    Tube operator|(const Trajectory& x, const Tube& y);
 
 
     /** \brief \f$[x](\cdot)\cap[y](\cdot)\f$
@@ -420,35 +420,575 @@ namespace codac
       * \param y
       * \return Tube output
       */
-    const Tube operator&(const Tube& x, const Tube& y);
+    Tube operator&(const Tube& x, const Tube& y);
 
     /** \brief \f$[x](\cdot)\cap[y]\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator&(const Tube& x, const Interval& y);
+    Tube operator&(const Tube& x, const Interval& y);
 
     /** \brief \f$[x]\cap[y](\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator&(const Interval& x, const Tube& y);
+    Tube operator&(const Interval& x, const Tube& y);
 
     /** \brief \f$[x](\cdot)\cap y(\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator&(const Tube& x, const Trajectory& y);
+    Tube operator&(const Tube& x, const Trajectory& y);
 
     /** \brief \f$x(\cdot)\cap [y](\cdot)\f$
       * \param x
       * \param y
       * \return Tube output
       */
-    const Tube operator&(const Trajectory& x, const Tube& y);
+    Tube operator&(const Trajectory& x, const Tube& y);
+
+  /// @}
+  /// \name Scalar outputs, computed in place in rvalue operands
+  /// \note These overloads reuse the slices of temporary tubes, so that an
+  ///       expression such as sin(y)+2.*z allocates its slices only once.
+  /// @{
+
+    /** \brief \f$[x](\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube operator+(Tube&& x);
+
+    /** \brief \f$-[x](\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube operator-(Tube&& x);
+
+    /** \brief \f$\cos([x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube cos(Tube&& x);
+
+    /** \brief \f$\sin([x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube sin(Tube&& x);
+
+    /** \brief \f$\mid[x](\cdot)\mid\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube abs(Tube&& x);
+
+    /** \brief \f$[x]^2(\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube sqr(Tube&& x);
+
+    /** \brief \f$\sqrt{[x](\cdot)}\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube sqrt(Tube&& x);
+
+    /** \brief \f$\exp([x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube exp(Tube&& x);
+
+    /** \brief \f$\log([x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube log(Tube&& x);
+
+    /** \brief \f$\tan([x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube tan(Tube&& x);
+
+    /** \brief \f$\arccos([x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube acos(Tube&& x);
+
+    /** \brief \f$\arcsin([x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube asin(Tube&& x);
+
+    /** \brief \f$\arctan([x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube atan(Tube&& x);
+
+    /** \brief \f$\cosh([x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube cosh(Tube&& x);
+
+    /** \brief \f$\sinh([x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube sinh(Tube&& x);
+
+    /** \brief \f$\tanh([x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube tanh(Tube&& x);
+
+    /** \brief \f$\mathrm{arccosh}([x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube acosh(Tube&& x);
+
+    /** \brief \f$\mathrm{arcsinh}([x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube asinh(Tube&& x);
+
+    /** \brief \f$\mathrm{arctanh}([x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param x
+      * \return Tube output
+      */
+    Tube atanh(Tube&& x);
+
+    /** \brief \f$[x]^p(\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param p
+      * \return Tube output
+      */
+    Tube pow(Tube&& x, int p);
+
+    /** \brief \f$[x]^p(\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param p
+      * \return Tube output
+      */
+    Tube pow(Tube&& x, double p);
+
+    /** \brief \f$[x]^{[p]}(\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param p
+      * \return Tube output
+      */
+    Tube pow(Tube&& x, const Interval& p);
+
+    /** \brief \f$\sqrt[p]{[x](\cdot)}\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param p
+      * \return Tube output
+      */
+    Tube root(Tube&& x, int p);
+
+    /** \brief \f$\mathrm{arctan2}([y](\cdot),[x](\cdot))\f$, computed in the slices of y, that is moved
+      * \param y
+      * \param x
+      * \return Tube output
+      */
+    Tube atan2(Tube&& y, const Tube& x);
+
+    /** \brief \f$\mathrm{arctan2}([y](\cdot),[x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param y
+      * \param x
+      * \return Tube output
+      */
+    Tube atan2(const Tube& y, Tube&& x);
+
+    /** \brief \f$\mathrm{arctan2}([y](\cdot),[x](\cdot))\f$, computed in the slices of y, that is moved
+      * \param y
+      * \param x
+      * \return Tube output
+      */
+    Tube atan2(Tube&& y, Tube&& x);
+
+    /** \brief \f$\mathrm{arctan2}([y](\cdot),[x])\f$, computed in the slices of y, that is moved
+      * \param y
+      * \param x
+      * \return Tube output
+      */
+    Tube atan2(Tube&& y, const Interval& x);
+
+    /** \brief \f$\mathrm{arctan2}([y],[x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param y
+      * \param x
+      * \return Tube output
+      */
+    Tube atan2(const Interval& y, Tube&& x);
+
+    /** \brief \f$\mathrm{min}([y](\cdot),[x](\cdot))\f$, computed in the slices of y, that is moved
+      * \param y
+      * \param x
+      * \return Tube output
+      */
+    Tube min(Tube&& y, const Tube& x);
+
+    /** \brief \f$\mathrm{min}([y](\cdot),[x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param y
+      * \param x
+      * \return Tube output
+      */
+    Tube min(const Tube& y, Tube&& x);
+
+    /** \brief \f$\mathrm{min}([y](\cdot),[x](\cdot))\f$, computed in the slices of y, that is moved
+      * \param y
+      * \param x
+      * \return Tube output
+      */
+    Tube min(Tube&& y, Tube&& x);
+
+    /** \brief \f$\mathrm{min}([y](\cdot),[x])\f$, computed in the slices of y, that is moved
+      * \param y
+      * \param x
+      * \return Tube output
+      */
+    Tube min(Tube&& y, const Interval& x);
+
+    /** \brief \f$\mathrm{min}([y],[x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param y
+      * \param x
+      * \return Tube output
+      */
+    Tube min(const Interval& y, Tube&& x);
+
+    /** \brief \f$\mathrm{max}([y](\cdot),[x](\cdot))\f$, computed in the slices of y, that is moved
+      * \param y
+      * \param x
+      * \return Tube output
+      */
+    Tube max(Tube&& y, const Tube& x);
+
+    /** \brief \f$\mathrm{max}([y](\cdot),[x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param y
+      * \param x
+      * \return Tube output
+      */
+    Tube max(const Tube& y, Tube&& x);
+
+    /** \brief \f$\mathrm{max}([y](\cdot),[x](\cdot))\f$, computed in the slices of y, that is moved
+      * \param y
+      * \param x
+      * \return Tube output
+      */
+    Tube max(Tube&& y, Tube&& x);
+
+    /** \brief \f$\mathrm{max}([y](\cdot),[x])\f$, computed in the slices of y, that is moved
+      * \param y
+      * \param x
+      * \return Tube output
+      */
+    Tube max(Tube&& y, const Interval& x);
+
+    /** \brief \f$\mathrm{max}([y],[x](\cdot))\f$, computed in the slices of x, that is moved
+      * \param y
+      * \param x
+      * \return Tube output
+      */
+    Tube max(const Interval& y, Tube&& x);
+
+    /** \brief \f$[x](\cdot)+[y](\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator+(Tube&& x, const Tube& y);
+
+    /** \brief \f$[x](\cdot)+[y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator+(const Tube& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)+[y](\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator+(Tube&& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)+[y]\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator+(Tube&& x, const Interval& y);
+
+    /** \brief \f$[x]+[y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator+(const Interval& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)+y(\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator+(Tube&& x, const Trajectory& y);
+
+    /** \brief \f$x(\cdot)+[y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator+(const Trajectory& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)-[y](\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator-(Tube&& x, const Tube& y);
+
+    /** \brief \f$[x](\cdot)-[y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator-(const Tube& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)-[y](\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator-(Tube&& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)-[y]\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator-(Tube&& x, const Interval& y);
+
+    /** \brief \f$[x]-[y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator-(const Interval& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)-y(\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator-(Tube&& x, const Trajectory& y);
+
+    /** \brief \f$x(\cdot)-[y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator-(const Trajectory& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)\cdot[y](\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator*(Tube&& x, const Tube& y);
+
+    /** \brief \f$[x](\cdot)\cdot[y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator*(const Tube& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)\cdot[y](\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator*(Tube&& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)\cdot[y]\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator*(Tube&& x, const Interval& y);
+
+    /** \brief \f$[x]\cdot[y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator*(const Interval& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)\cdot y(\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator*(Tube&& x, const Trajectory& y);
+
+    /** \brief \f$x(\cdot)\cdot[y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator*(const Trajectory& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)/[y](\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator/(Tube&& x, const Tube& y);
+
+    /** \brief \f$[x](\cdot)/[y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator/(const Tube& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)/[y](\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator/(Tube&& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)/[y]\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator/(Tube&& x, const Interval& y);
+
+    /** \brief \f$[x]/[y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator/(const Interval& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)/y(\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator/(Tube&& x, const Trajectory& y);
+
+    /** \brief \f$[x](\cdot)\sqcup[y](\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator|(Tube&& x, const Tube& y);
+
+    /** \brief \f$[x](\cdot)\sqcup[y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator|(const Tube& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)\sqcup[y](\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator|(Tube&& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)\sqcup[y]\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator|(Tube&& x, const Interval& y);
+
+    /** \brief \f$[x]\sqcup[y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator|(const Interval& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)\sqcup y(\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator|(Tube&& x, const Trajectory& y);
+
+    /** \brief \f$x(\cdot)\sqcup [y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator|(const Trajectory& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)\cap[y](\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator&(Tube&& x, const Tube& y);
+
+    /** \brief \f$[x](\cdot)\cap[y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator&(const Tube& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)\cap[y](\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator&(Tube&& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)\cap[y]\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator&(Tube&& x, const Interval& y);
+
+    /** \brief \f$[x]\cap[y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator&(const Interval& x, Tube&& y);
+
+    /** \brief \f$[x](\cdot)\cap y(\cdot)\f$, computed in the slices of x, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator&(Tube&& x, const Trajectory& y);
+
+    /** \brief \f$x(\cdot)\cap [y](\cdot)\f$, computed in the slices of y, that is moved
+      * \param x
+      * \param y
+      * \return Tube output
+      */
+    Tube operator&(const Trajectory& x, Tube&& y);
 
   /// @}
   /// \name Vector outputs
@@ -459,84 +999,84 @@ namespace codac
       * \param x
       * \return TubeVector output
       */
-    const TubeVector operator+(const TubeVector& x);
+    TubeVector operator+(const TubeVector& x);
 
     /** \brief \f$[\mathbf{x}](\cdot)+[\mathbf{y}](\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator+(const TubeVector& x, const TubeVector& y);
+    TubeVector operator+(const TubeVector& x, const TubeVector& y);
 
     /** \brief \f$[\mathbf{x}](\cdot)+[\mathbf{y}]\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator+(const TubeVector& x, const IntervalVector& y);
+    TubeVector operator+(const TubeVector& x, const IntervalVector& y);
 
     /** \brief \f$[\mathbf{x}]+[\mathbf{y}](\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator+(const IntervalVector& x, const TubeVector& y);
+    TubeVector operator+(const IntervalVector& x, const TubeVector& y);
 
     /** \brief \f$[\mathbf{x}](\cdot)+\mathbf{y}(\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator+(const TubeVector& x, const TrajectoryVector& y);
+    TubeVector operator+(const TubeVector& x, const TrajectoryVector& y);
 
     /** \brief \f$\mathbf{x}(\cdot)+[\mathbf{y}](\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator+(const TrajectoryVector& x, const TubeVector& y);
+    TubeVector operator+(const TrajectoryVector& x, const TubeVector& y);
 
 
     /** \brief \f$-[\mathbf{x}](\cdot)\f$
       * \param x
       * \return TubeVector output
       */
-    const TubeVector operator-(const TubeVector& x);
+    TubeVector operator-(const TubeVector& x);
 
     /** \brief \f$[\mathbf{x}](\cdot)-[\mathbf{y}](\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator-(const TubeVector& x, const TubeVector& y);
+    TubeVector operator-(const TubeVector& x, const TubeVector& y);
 
     /** \brief \f$[\mathbf{x}](\cdot)-[\mathbf{y}]\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator-(const TubeVector& x, const IntervalVector& y);
+    TubeVector operator-(const TubeVector& x, const IntervalVector& y);
 
     /** \brief \f$[\mathbf{x}]-[\mathbf{y}](\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator-(const IntervalVector& x, const TubeVector& y);
+    TubeVector operator-(const IntervalVector& x, const TubeVector& y);
 
     /** \brief \f$[\mathbf{x}](\cdot)-\mathbf{y}(\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator-(const TubeVector& x, const TrajectoryVector& y);
+    TubeVector operator-(const TubeVector& x, const TrajectoryVector& y);
 
     /** \brief \f$\mathbf{x}(\cdot)-[\mathbf{y}](\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator-(const TrajectoryVector& x, const TubeVector& y);
+    TubeVector operator-(const TrajectoryVector& x, const TubeVector& y);
 
 
     /** \brief \f$[x](\cdot)\cdot[\mathbf{y}](\cdot)\f$
@@ -544,28 +1084,28 @@ namespace codac
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator*(const Tube& x, const TubeVector& y);
+    TubeVector operator*(const Tube& x, const TubeVector& y);
 
     /** \brief \f$[x]\cdot[\mathbf{y}](\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator*(const Interval& x, const TubeVector& y);
+    TubeVector operator*(const Interval& x, const TubeVector& y);
 
     /** \brief \f$[x](\cdot)\cdot[\mathbf{y}]\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator*(const Tube& x, const IntervalVector& y);
+    TubeVector operator*(const Tube& x, const IntervalVector& y);
 
     /** \brief \f$x(\cdot)\cdot[\mathbf{y}](\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator*(const Trajectory& x, const TubeVector& y);
+    TubeVector operator*(const Trajectory& x, const TubeVector& y);
 
 
     /** \brief \f$[\mathbf{x}](\cdot)/[y](\cdot)\f$
@@ -573,28 +1113,28 @@ namespace codac
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator/(const TubeVector& x, const Tube& y);
+    TubeVector operator/(const TubeVector& x, const Tube& y);
 
     /** \brief \f$[\mathbf{x}](\cdot)/[y]\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator/(const TubeVector& x, const Interval& y);
+    TubeVector operator/(const TubeVector& x, const Interval& y);
 
     /** \brief \f$[\mathbf{x}]/[y](\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator/(const IntervalVector& x, const Tube& y);
+    TubeVector operator/(const IntervalVector& x, const Tube& y);
 
     /** \brief \f$[\mathbf{x}](\cdot)/y(\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator/(const TubeVector& x, const Trajectory& y);
+    TubeVector operator/(const TubeVector& x, const Trajectory& y);
 
 
     /** \brief \f$[\mathbf{x}](\cdot)\sqcup[\mathbf{y}](\cdot)\f$
@@ -602,35 +1142,35 @@ namespace codac
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator|(const TubeVector& x, const TubeVector& y);
+    TubeVector operator|(const TubeVector& x, const TubeVector& y);
 
     /** \brief \f$[\mathbf{x}](\cdot)\sqcup[\mathbf{y}]\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator|(const TubeVector& x, const IntervalVector& y);
+    TubeVector operator|(const TubeVector& x, const IntervalVector& y);
 
     /** \brief \f$[\mathbf{x}]\sqcup[\mathbf{y}](\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator|(const IntervalVector& x, const TubeVector& y);
+    TubeVector operator|(const IntervalVector& x, const TubeVector& y);
 
     /** \brief \f$[\mathbf{x}](\cdot)\sqcup\mathbf{y}(\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator|(const TubeVector& x, const TrajectoryVector& y);
+    TubeVector operator|(const TubeVector& x, const TrajectoryVector& y);
 
     /** \brief \f$\mathbf{x}(\cdot)\sqcup[\mathbf{y}](\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator|(const TrajectoryVector& x, const TubeVector& y);
+    TubeVector operator|(const TrajectoryVector& x, const TubeVector& y);
 
 
     /** \brief \f$[\mathbf{x}](\cdot)\cap[\mathbf{y}](\cdot)\f$
@@ -638,42 +1178,42 @@ namespace codac
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator&(const TubeVector& x, const TubeVector& y);
+    TubeVector operator&(const TubeVector& x, const TubeVector& y);
 
     /** \brief \f$[\mathbf{x}](\cdot)\cap[\mathbf{y}]\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator&(const TubeVector& x, const IntervalVector& y);
+    TubeVector operator&(const TubeVector& x, const IntervalVector& y);
 
     /** \brief \f$[\mathbf{x}]\cap[\mathbf{y}](\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator&(const IntervalVector& x, const TubeVector& y);
+    TubeVector operator&(const IntervalVector& x, const TubeVector& y);
 
     /** \brief \f$[\mathbf{x}](\cdot)\cap\mathbf{y}(\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator&(const TubeVector& x, const TrajectoryVector& y);
+    TubeVector operator&(const TubeVector& x, const TrajectoryVector& y);
 
     /** \brief \f$\mathbf{x}(\cdot)\cap[\mathbf{y}](\cdot)\f$
       * \param x
       * \param y
       * \return TubeVector output
       */
-    const TubeVector operator&(const TrajectoryVector& x, const TubeVector& y);
+    TubeVector operator&(const TrajectoryVector& x, const TubeVector& y);
 
 
     /** \brief \f$\mid\mathbf{x}(\cdot)\mid\f$
       * \param x
       * \return TubeVector output
       */
-    const TubeVector abs(const TubeVector& x);
+    TubeVector abs(const TubeVector& x);
 
   /// @}
 }
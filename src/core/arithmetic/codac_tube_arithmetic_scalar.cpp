@@ -10,84 +10,76 @@
  */
 
 #include "codac_tube_arithmetic.h"
+#include <utility>
 #include "codac_Slice.h"
+#include "codac_IntervalArray.h"
 
 using namespace std;
 using namespace ibex;
 
 namespace codac
 {
-  const Tube operator+(const Tube& x)
+  // The evaluations are made in place in the slices of rvalue tubes (Tube::apply):
+  // the storage of temporary operands is reused for the results.
+  // Versions with const references compute the results while copying
+  // the slicing of the operands, in a single pass (Tube kernel constructors).
+  // The arithmetic operations, sqr and sqrt are computed on the contiguous
+  // values of the tubes by the vectorized interval kernels of IntervalArray.
+
+  Tube operator+(const Tube& x)
   {
     return x;
   }
 
-  const Tube operator-(const Tube& x)
+  Tube operator+(Tube&& x)
   {
-    Tube y(x);
-    Slice *s_y = NULL;
-    const Slice *s_x = NULL;
-
-    do
-    {
-      if(s_y == NULL) // first iteration
-      {
-        s_y = y.first_slice();
-        s_x = x.first_slice();
-      }
-
-      else
-      {
-        s_y = s_y->next_slice();
-        s_x = s_x->next_slice();
-      }
-
-      s_y->set_envelope(-s_x->codomain(), false);
-      s_y->set_input_gate(-s_x->input_gate(), false);
+    return std::move(x);
+  }
 
-    } while(s_y->next_slice() != NULL);
+  Tube operator-(Tube&& x)
+  {
+    x.apply([](const Interval& y) { return -y; });
+    return std::move(x);
+  }
 
-    s_y->set_output_gate(-s_x->output_gate(), false);
-    return y;
+  Tube operator-(const Tube& x)
+  {
+    return Tube(x, [](const Interval& y) { return -y; });
   }
     
   #define macro_scal_unary(f) \
     \
-    const Tube f(const Tube& x) \
+    Tube f(Tube&& x) \
     { \
-      Tube y(x); \
-      Slice *s_y = NULL; \
-      const Slice *s_x = NULL; \
-      \
-      do \
-      { \
-        if(s_y == NULL) /* first iteration */ \
-        { \
-          s_y = y.first_slice(); \
-          s_x = x.first_slice(); \
-        } \
-        \
-        else \
-        { \
-          s_y = s_y->next_slice(); \
-          s_x = s_x->next_slice(); \
-        } \
-        \
-        s_y->set_envelope(ibex::f(s_x->codomain()), false); \
-        s_y->set_input_gate(ibex::f(s_x->input_gate()), false); \
-        \
-      } while(s_y->next_slice() != NULL); \
-      \
-      s_y->set_output_gate(ibex::f(s_x->output_gate()), false); \
-      return y; \
+      x.apply([](const Interval& y) { return ibex::f(y); }); \
+      return std::move(x); \
+    } \
+    \
+    Tube f(const Tube& x) \
+    { \
+      return Tube(x, [](const Interval& y) { return ibex::f(y); }); \
+    } \
+    \
+
+  #define macro_scal_unary_kernel(f) \
+    \
+    Tube f(Tube&& x) \
+    { \
+      x.set_values(f(x.values())); \
+      return std::move(x); \
+    } \
+    \
+    Tube f(const Tube& x) \
+    { \
+      return Tube(x, f(x.values())); \
     } \
     \
 
   macro_scal_unary(cos);
   macro_scal_unary(sin);
   macro_scal_unary(abs);
-  macro_scal_unary(sqr);
-  macro_scal_unary(sqrt);
+  macro_scal_unary_kernel(sqr);
+  macro_scal_unary_kernel(sqrt);
   macro_scal_unary(exp);
   macro_scal_unary(log);
   macro_scal_unary(tan);
@@ -103,33 +95,15 @@ namespace codac
     
   #define macro_scal_unary_param(f, p) \
     \
-    const Tube f(const Tube& x, p param) \
+    Tube f(Tube&& x, p param) \
     { \
-      Tube y(x); \
-      Slice *s_y = NULL; \
-      const Slice *s_x = NULL; \
-      \
-      do \
-      { \
-        if(s_y == NULL) /* first iteration */ \
-        { \
-          s_y = y.first_slice(); \
-          s_x = x.first_slice(); \
-        } \
-        \
-        else \
-        { \
-          s_y = s_y->next_slice(); \
-          s_x = s_x->next_slice(); \
-        } \
-        \
-        s_y->set_envelope(ibex::f(s_x->codomain(), param), false); \
-        s_y->set_input_gate(ibex::f(s_x->input_gate(), param), false); \
-        \
-      } while(s_y->next_slice() != NULL); \
-      \
-      s_y->set_output_gate(ibex::f(s_x->output_gate(), param), false); \
-      return y; \
+      x.apply([&param](const Interval& y) { return ibex::f(y, param); }); \
+      return std::move(x); \
+    } \
+    \
+    Tube f(const Tube& x, p param) \
+    { \
+      return Tube(x, [&param](const Interval& y) { return ibex::f(y, param); }); \
     } \
     \
 
@@ -140,122 +114,184 @@ namespace codac
 
   #define macro_scal_binary(f) \
     \
-    const Tube f(const Tube& x1, const Tube& x2) \
+    Tube f(Tube&& x1, const Tube& x2) \
     { \
       assert(x1.tdomain() == x2.tdomain()); \
       \
-      Tube y(x1); \
-      const Slice *s_x1, *s_x2; \
-      \
-      Tube *x1_resampled = NULL; /* In case of different slicing between x1 and x2, */ \
-      Tube *x2_resampled = NULL; /* copies of x1 and x2 will be made and equally resampled. */ \
+      const Tube *x2_ = &x2; \
+      Tube *x2_resampled = NULL; /* In case of different slicing between x1 and x2, */ \
+                                 /* a copy of x2 is made and both are equally resampled. */ \
+      if(!Tube::same_slicing(x1, x2)) \
+      { \
+        x2_resampled = new Tube(x2); \
+        x2_resampled->sample(x1); /* common sampling */ \
+        x1.sample(x2); \
+        x2_ = x2_resampled; \
+      } \
       \
-      if(Tube::same_slicing(x1, x2)) /* faster, no sampling computation needed */ \
+      const Slice *s_x2 = x2_->first_slice(); \
+      for(Slice *s_y = x1.first_slice() ; s_y != NULL ; s_y = s_y->next_slice()) \
       { \
-        s_x1 = x1.first_slice(); \
-        s_x2 = x2.first_slice(); \
+        s_y->set_envelope(ibex::f(s_y->codomain(), s_x2->codomain()), false); \
+        s_y->set_input_gate(ibex::f(s_y->input_gate(), s_x2->input_gate()), false); \
+        if(s_y->next_slice() == NULL) \
+          s_y->set_output_gate(ibex::f(s_y->output_gate(), s_x2->output_gate()), false); \
+        s_x2 = s_x2->next_slice(); \
       } \
       \
-      else \
+      if(x2_resampled != NULL) delete x2_resampled; \
+      return std::move(x1); \
+    } \
+    \
+    Tube f(const Tube& x1, Tube&& x2) \
+    { \
+      assert(x1.tdomain() == x2.tdomain()); \
+      \
+      const Tube *x1_ = &x1; \
+      Tube *x1_resampled = NULL; /* In case of different slicing between x1 and x2, */ \
+                                 /* a copy of x1 is made and both are equally resampled. */ \
+      if(!Tube::same_slicing(x1, x2)) \
       { \
         x1_resampled = new Tube(x1); \
-        x2_resampled = new Tube(x2); \
         x1_resampled->sample(x2); /* common sampling */ \
-        x2_resampled->sample(x1); \
-        y.sample(*x2_resampled); \
-        s_x1 = x1_resampled->first_slice(); \
-        s_x2 = x2_resampled->first_slice(); \
+        x2.sample(x1); \
+        x1_ = x1_resampled; \
       } \
       \
-      Slice *s_y = NULL; \
-      do \
+      const Slice *s_x1 = x1_->first_slice(); \
+      for(Slice *s_y = x2.first_slice() ; s_y != NULL ; s_y = s_y->next_slice()) \
       { \
-        if(s_y == NULL) /* first iteration */ \
-          s_y = y.first_slice(); \
-        \
-        else \
-        { \
-          s_y = s_y->next_slice(); \
-          s_x1 = s_x1->next_slice(); \
-          s_x2 = s_x2->next_slice(); \
-        } \
-        \
-        s_y->set_envelope(ibex::f(s_x1->codomain(), s_x2->codomain()), false); \
-        s_y->set_input_gate(ibex::f(s_x1->input_gate(), s_x2->input_gate()), false); \
-        \
-      } while(s_y->next_slice() != NULL); \
-      \
-      s_y->set_output_gate(ibex::f(s_x1->output_gate(), s_x2->output_gate()), false); \
+        s_y->set_envelope(ibex::f(s_x1->codomain(), s_y->codomain()), false); \
+        s_y->set_input_gate(ibex::f(s_x1->input_gate(), s_y->input_gate()), false); \
+        if(s_y->next_slice() == NULL) \
+          s_y->set_output_gate(ibex::f(s_x1->output_gate(), s_y->output_gate()), false); \
+        s_x1 = s_x1->next_slice(); \
+      } \
       \
       if(x1_resampled != NULL) delete x1_resampled; \
-      if(x2_resampled != NULL) delete x2_resampled; \
-      return y; \
+      return std::move(x2); \
+    } \
+    \
+    Tube f(Tube&& x1, Tube&& x2) \
+    { \
+      return f(std::move(x1), static_cast<const Tube&>(x2)); \
     } \
     \
-    const Tube f(const Tube& x1, const Interval& x2) \
+    Tube f(const Tube& x1, const Tube& x2) \
     { \
-      Tube y(x1); \
-      Slice *s_y = NULL; \
-      const Slice *s_x1 = NULL; \
+      if(!Tube::same_slicing(x1, x2)) /* resampling needed */ \
+        return f(Tube(x1), x2); \
       \
-      do \
+      return Tube(x1, x2, [](const Interval& y1, const Interval& y2) { return ibex::f(y1, y2); }); \
+    } \
+    \
+    Tube f(Tube&& x1, const Interval& x2) \
+    { \
+      for(Slice *s_y = x1.first_slice() ; s_y != NULL ; s_y = s_y->next_slice()) \
       { \
-        if(s_y == NULL) /* first iteration */ \
-        { \
-          s_y = y.first_slice(); \
-          s_x1 = x1.first_slice(); \
-        } \
-        \
-        else \
-        { \
-          s_y = s_y->next_slice(); \
-          s_x1 = s_x1->next_slice(); \
-        } \
-        \
-        s_y->set_envelope(ibex::f(s_x1->codomain(), x2), false); \
-        s_y->set_input_gate(ibex::f(s_x1->input_gate(), x2), false); \
-        \
-      } while(s_y->next_slice() != NULL); \
+        s_y->set_envelope(ibex::f(s_y->codomain(), x2), false); \
+        s_y->set_input_gate(ibex::f(s_y->input_gate(), x2), false); \
+      } \
       \
-      s_y->set_output_gate(ibex::f(s_x1->output_gate(), x2), false); \
+      x1.last_slice()->set_output_gate(ibex::f(x1.last_slice()->output_gate(), x2), false); \
+      return std::move(x1); \
+    } \
+    \
+    Tube f(const Tube& x1, const Interval& x2) \
+    { \
+      return Tube(x1, [&x2](const Interval& y1) { return ibex::f(y1, x2); }); \
+    } \
+    \
+    Tube f(const Interval& x1, Tube&& x2) \
+    { \
+      for(Slice *s_y = x2.first_slice() ; s_y != NULL ; s_y = s_y->next_slice()) \
+      { \
+        s_y->set_envelope(ibex::f(x1, s_y->codomain()), false); \
+        s_y->set_input_gate(ibex::f(x1, s_y->input_gate()), false); \
+      } \
       \
-      return y; \
+      x2.last_slice()->set_output_gate(ibex::f(x1, x2.last_slice()->output_gate()), false); \
+      return std::move(x2); \
+    } \
+    \
+    Tube f(const Interval& x1, const Tube& x2) \
+    { \
+      return Tube(x2, [&x1](const Interval& y2) { return ibex::f(x1, y2); }); \
     } \
+
+  #define macro_scal_binary_kernel(f) \
     \
-    const Tube f(const Interval& x1, const Tube& x2) \
+    Tube f(Tube&& x1, const Tube& x2) \
     { \
-      Tube y(x2); \
-      Slice *s_y = NULL; \
-      const Slice *s_x2 = NULL; \
+      assert(x1.tdomain() == x2.tdomain()); \
       \
-      do \
+      if(!Tube::same_slicing(x1, x2)) \
       { \
-        if(s_y == NULL) /* first iteration */ \
-        { \
-          s_y = y.first_slice(); \
-          s_x2 = x2.first_slice(); \
-        } \
-        \
-        else \
-        { \
-          s_y = s_y->next_slice(); \
-          s_x2 = s_x2->next_slice(); \
-        } \
-        \
-        s_y->set_envelope(ibex::f(x1, s_x2->codomain()), false); \
-        s_y->set_input_gate(ibex::f(x1, s_x2->input_gate()), false); \
-        \
-      } while(s_y->next_slice() != NULL); \
+        Tube x2_resampled(x2); /* In case of different slicing between x1 and x2, */ \
+        x2_resampled.sample(x1); /* a copy of x2 is made and both are equally resampled. */ \
+        x1.sample(x2); \
+        return f(std::move(x1), x2_resampled); \
+      } \
       \
-      s_y->set_output_gate(ibex::f(x1, s_x2->output_gate()), false); \
+      x1.set_values(f(x1.values(), x2.values())); \
+      return std::move(x1); \
+    } \
+    \
+    Tube f(const Tube& x1, Tube&& x2) \
+    { \
+      assert(x1.tdomain() == x2.tdomain()); \
       \
-      return y; \
+      if(!Tube::same_slicing(x1, x2)) \
+      { \
+        Tube x1_resampled(x1); /* In case of different slicing between x1 and x2, */ \
+        x1_resampled.sample(x2); /* a copy of x1 is made and both are equally resampled. */ \
+        x2.sample(x1); \
+        return f(x1_resampled, std::move(x2)); \
+      } \
+      \
+      x2.set_values(f(x1.values(), x2.values())); \
+      return std::move(x2); \
+    } \
+    \
+    Tube f(Tube&& x1, Tube&& x2) \
+    { \
+      return f(std::move(x1), static_cast<const Tube&>(x2)); \
+    } \
+    \
+    Tube f(const Tube& x1, const Tube& x2) \
+    { \
+      if(!Tube::same_slicing(x1, x2)) /* resampling needed */ \
+        return f(Tube(x1), x2); \
+      \
+      return Tube(x1, f(x1.values(), x2.values())); \
+    } \
+    \
+    Tube f(Tube&& x1, const Interval& x2) \
+    { \
+      x1.set_values(f(x1.values(), x2)); \
+      return std::move(x1); \
+    } \
+    \
+    Tube f(const Tube& x1, const Interval& x2) \
+    { \
+      return Tube(x1, f(x1.values(), x2)); \
+    } \
+    \
+    Tube f(const Interval& x1, Tube&& x2) \
+    { \
+      x2.set_values(f(x1, x2.values())); \
+      return std::move(x2); \
+    } \
+    \
+    Tube f(const Interval& x1, const Tube& x2) \
+    { \
+      return Tube(x2, f(x1, x2.values())); \
     } \
 
-  macro_scal_binary(operator+);
-  macro_scal_binary(operator-);
-  macro_scal_binary(operator*);
-  macro_scal_binary(operator/);
+  macro_scal_binary_kernel(operator+);
+  macro_scal_binary_kernel(operator-);
+  macro_scal_binary_kernel(operator*);
+  macro_scal_binary_kernel(operator/);
   macro_scal_binary(operator|);
   macro_scal_binary(operator&);
   macro_scal_binary(atan2);
@@ -264,83 +300,57 @@ namespace codac
 
   #define macro_scal_binary_traj(f, feq) \
     \
-    const Tube f(const Tube& x1, const Trajectory& x2) \
+    Tube f(Tube&& x1, const Trajectory& x2) \
     { \
       assert(x1.tdomain() == x2.tdomain()); \
-      Tube y(x1); \
-      y.feq(x2); \
-      return y; \
+      x1.feq(x2); \
+      return std::move(x1); \
     } \
     \
-    const Tube f(const Trajectory& x1, const Tube& x2) \
+    Tube f(const Tube& x1, const Trajectory& x2) \
     { \
-      assert(x1.tdomain() == x2.tdomain()); \
-      Tube y(x2); \
-      y.feq(x1); \
-      return y; \
+      return f(Tube(x1), x2); \
     } \
     \
 
-  macro_scal_binary_traj(operator|, operator|=);
-  macro_scal_binary_traj(operator&, operator&=);
-
-  const Tube operator+(const Tube& x1, const Trajectory& x2)
-  {
-    assert(x1.tdomain() == x2.tdomain());
-    Tube y(x1);
-    y.operator+=(x2);
-    return y;
-  }
-
-  const Tube operator+(const Trajectory& x1, const Tube& x2)
-  {
-    assert(x1.tdomain() == x2.tdomain());
-    Tube y(x2);
-    y.operator+=(x1);
-    return y;
-  }
+  #define macro_scal_binary_traj_commutative(f, feq) \
+    \
+    macro_scal_binary_traj(f, feq) \
+    \
+    Tube f(const Trajectory& x1, Tube&& x2) \
+    { \
+      assert(x1.tdomain() == x2.tdomain()); \
+      x2.feq(x1); \
+      return std::move(x2); \
+    } \
+    \
+    Tube f(const Trajectory& x1, const Tube& x2) \
+    { \
+      return f(x1, Tube(x2)); \
+    } \
+    \
 
-  const Tube operator-(const Tube& x1, const Trajectory& x2)
-  {
-    assert(x1.tdomain() == x2.tdomain());
-    Tube y(x1);
-    y.operator-=(x2);
-    return y;
-  }
+  macro_scal_binary_traj_commutative(operator|, operator|=);
+  macro_scal_binary_traj_commutative(operator&, operator&=);
+  macro_scal_binary_traj_commutative(operator+, operator+=);
+  macro_scal_binary_traj_commutative(operator*, operator*=);
+  macro_scal_binary_traj(operator-, operator-=);
+  macro_scal_binary_traj(operator/, operator/=);
 
-  const Tube operator-(const Trajectory& x1, const Tube& x2)
+  Tube operator-(const Trajectory& x1, Tube&& x2)
   {
     assert(x1.tdomain() == x2.tdomain());
-    Tube y = -x2;
+    Tube y = -std::move(x2);
     y.operator+=(x1);
     return y;
   }
 
-  const Tube operator*(const Tube& x1, const Trajectory& x2)
-  {
-    assert(x1.tdomain() == x2.tdomain());
-    Tube y(x1);
-    y.operator*=(x2);
-    return y;
-  }
-
-  const Tube operator*(const Trajectory& x1, const Tube& x2)
-  {
-    assert(x1.tdomain() == x2.tdomain());
-    Tube y(x2);
-    y.operator*=(x1);
-    return y;
-  }
-
-  const Tube operator/(const Tube& x1, const Trajectory& x2)
+  Tube operator-(const Trajectory& x1, const Tube& x2)
   {
-    assert(x1.tdomain() == x2.tdomain());
-    Tube y(x1);
-    y.operator/=(x2);
-    return y;
+    return x1 - Tube(x2);
   }
 
-  const Tube operator/(const Trajectory& x1, const Tube& x2)
+  Tube operator/(const Trajectory& x1, const Tube& x2)
   {
     assert(x1.tdomain() == x2.tdomain());
     Tube y(x2); // same sampling
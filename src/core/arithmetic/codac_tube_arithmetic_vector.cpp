@@ -8,6 +8,7 @@
  *              the GNU Lesser General Public License (LGPL).
  */
 
+#include <utility>
 #include "codac_tube_arithmetic.h"
 #include "codac_Slice.h"
 
@@ -16,71 +17,70 @@ using namespace ibex;
 
 namespace codac
 {
-  const TubeVector operator+(const TubeVector& x)
+  TubeVector operator+(const TubeVector& x)
   {
     return x;
   }
 
-  const TubeVector operator-(const TubeVector& x)
+  TubeVector operator-(const TubeVector& x)
   {
     TubeVector y(x);
-    for(int i = 0 ; i < y.size() ; i++)
-      y[i] = -y[i];
+    y.apply([](const Interval& z) { return -z; });
     return y;
   }
 
   #define macro_vect_binary(f) \
     \
-    const TubeVector f(const TubeVector& x1, const TubeVector& x2) \
+    TubeVector f(const TubeVector& x1, const TubeVector& x2) \
     { \
       assert(x1.size() == x2.size()); \
       assert(x1.tdomain() == x2.tdomain()); \
       \
       TubeVector y(x1); \
       for(int i = 0 ; i < y.size() ; i++) \
-        y[i] = codac::f(x1[i], x2[i]); \
+        y[i] = codac::f(std::move(y[i]), x2[i]); \
       return y; \
     } \
     \
-    const TubeVector f(const TubeVector& x1, const IntervalVector& x2) \
+    TubeVector f(const TubeVector& x1, const IntervalVector& x2) \
     { \
       assert(x1.size() == x2.size()); \
       \
       TubeVector y(x1); \
       for(int i = 0 ; i < y.size() ; i++) \
-        y[i] = codac::f(x1[i], x2[i]); \
+        y[i] = codac::f(std::move(y[i]), x2[i]); \
       return y; \
     } \
     \
-    const TubeVector f(const IntervalVector& x1, const TubeVector& x2) \
+    TubeVector f(const IntervalVector& x1, const TubeVector& x2) \
     { \
       assert(x1.size() == x2.size()); \
       \
       TubeVector y(x2); \
       for(int i = 0 ; i < y.size() ; i++) \
-        y[i] = codac::f(x1[i], x2[i]); \
+        y[i] = codac::f(x1[i], std::move(y[i])); \
       return y; \
     } \
     \
-    const TubeVector f(const TubeVector& x1, const TrajectoryVector& x2) \
+    TubeVector f(const TubeVector& x1, const TrajectoryVector& x2) \
     { \
       assert(x1.size() == x2.size()); \
       assert(x1.tdomain() == x2.tdomain()); \
       \
       TubeVector y(x1); \
       for(int i = 0 ; i < y.size() ; i++) \
-        y[i] = codac::f(x1[i], x2[i]); \
+        y[i] = codac::f(std::move(y[i]), x2[i]); \
       return y; \
     } \
     \
-    const TubeVector f(const TrajectoryVector& x1, const TubeVector& x2) \
+    TubeVector f(const TrajectoryVector& x1, const TubeVector& x2) \
     { \
       assert(x1.size() == x2.size()); \
       assert(x1.tdomain() == x2.tdomain()); \
       \
       TubeVector y(x2); \
       for(int i = 0 ; i < y.size() ; i++) \
-        y[i] = codac::f(x1[i], x2[i]); \
+        y[i] = codac::f(x1[i], std::move(y[i])); \
       return y; \
     } \
     \
@@ -90,80 +90,79 @@ namespace codac
   macro_vect_binary(operator|);
   macro_vect_binary(operator&);
 
-  const TubeVector operator*(const Interval& x1, const TubeVector& x2)
+  TubeVector operator*(const Interval& x1, const TubeVector& x2)
   {
     TubeVector y(x2);
     for(int i = 0 ; i < y.size() ; i++)
-      y[i] = operator*(x1, y[i]);
+      y[i] = operator*(x1, std::move(y[i]));
     return y;
   }
 
-  const TubeVector operator*(const Tube& x1, const IntervalVector& x2)
+  TubeVector operator*(const Tube& x1, const IntervalVector& x2)
   {
     TubeVector y(x2.size(), x1);
     for(int i = 0 ; i < y.size() ; i++)
-      y[i] = operator*(y[i], x2[i]);
+      y[i] = operator*(std::move(y[i]), x2[i]);
     return y;
   }
 
-  const TubeVector operator*(const Tube& x1, const TubeVector& x2)
+  TubeVector operator*(const Tube& x1, const TubeVector& x2)
   {
     assert(x1.tdomain() == x2.tdomain()); \
     TubeVector y(x2);
     for(int i = 0 ; i < y.size() ; i++)
-      y[i] = operator*(x1, y[i]);
+      y[i] = operator*(x1, std::move(y[i]));
     return y;
   }
 
-  const TubeVector operator*(const Trajectory& x1, const TubeVector& x2)
+  TubeVector operator*(const Trajectory& x1, const TubeVector& x2)
   {
     assert(x1.tdomain() == x2.tdomain()); \
     TubeVector y(x2);
     for(int i = 0 ; i < y.size() ; i++)
-      y[i] = operator*(x1, y[i]);
+      y[i] = operator*(x1, std::move(y[i]));
     return y;
   }
 
-  const TubeVector operator/(const TubeVector& x1, const Interval& x2)
+  TubeVector operator/(const TubeVector& x1, const Interval& x2)
   {
     TubeVector y(x1);
     for(int i = 0 ; i < y.size() ; i++)
-      y[i] = operator/(y[i], x2);
+      y[i] = operator/(std::move(y[i]), x2);
     return y;
   }
 
-  const TubeVector operator/(const IntervalVector& x1, const Tube& x2)
+  TubeVector operator/(const IntervalVector& x1, const Tube& x2)
   {
     TubeVector y(x1.size(), x2);
     y.set(x1);
     for(int i = 0 ; i < y.size() ; i++)
-      y[i] = operator/(y[i], x2);
+      y[i] = operator/(std::move(y[i]), x2);
     return y;
   }
 
-  const TubeVector operator/(const TubeVector& x1, const Tube& x2)
+  TubeVector operator/(const TubeVector& x1, const Tube& x2)
   {
     assert(x1.tdomain() == x2.tdomain()); \
     TubeVector y(x1);
     for(int i = 0 ; i < y.size() ; i++)
-      y[i] = operator/(y[i], x2);
+      y[i] = operator/(std::move(y[i]), x2);
     return y;
   }
 
-  const TubeVector operator/(const TubeVector& x1, const Trajectory& x2)
+  TubeVector operator/(const TubeVector& x1, const Trajectory& x2)
   {
     assert(x1.tdomain() == x2.tdomain()); \
     TubeVector y(x1);
     for(int i = 0 ; i < y.size() ; i++)
-      y[i] = operator/(y[i], x2);
+      y[i] = operator/(std::move(y[i]), x2);
     return y;
   }
 
-  const TubeVector abs(const TubeVector& x)
+  TubeVector abs(const TubeVector& x)
   {
-    TubeVector y(x.tdomain(), x.size());
-    for(int i = 0 ; i < x.size() ; i++)
-      y[i] = abs(x[i]);
+    TubeVector y(x);
+    y.apply([](const Interval& z) { return ibex::abs(z); });
     return y;
   }
 }
\ No newline at end of file
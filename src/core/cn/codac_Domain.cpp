@@ -446,27 +446,14 @@ namespace codac
       }
 
       case Type::T_TUBE:
-      {
-        double vol = tube().volume();
-        vol += tube().first_slice()->input_gate().diam();
-        for(const Slice *s = tube().first_slice() ; s != NULL ; s = s->next_slice())
-          vol += s->output_gate().diam();
-        return vol;
-      }
+        // Cached by the tube until its next modification
+        return tube().volume() + tube().sum_gates_diam();
 
       case Type::T_TUBE_VECTOR:
       {
-        // todo: improve this
         double vol = 0.;
-
         for(int i = 0 ; i < tube_vector().size() ; i++)
-        {
-          vol += tube_vector()[i].volume();
-          vol += tube_vector()[i].first_slice()->input_gate().diam();
-          for(const Slice *s = tube_vector()[i].first_slice() ; s != NULL ; s = s->next_slice())
-            vol += s->output_gate().diam();
-        }
-        
+          vol += tube_vector()[i].volume() + tube_vector()[i].sum_gates_diam();
         return vol;
       }
 
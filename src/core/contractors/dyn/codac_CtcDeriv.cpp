@@ -77,16 +77,28 @@ namespace codac
   {
     assert(x.tdomain() == v.tdomain());
     assert(Tube::same_slicing(x, v));
+
+    int i0, i1; // range of slices to be revisited (all of them, out of incremental mode)
+    if(!modified_slices({ &x, &v }, i0, i1))
+      return;
+
+    int i_last = i1;
     
     if(t_propa & TimePropag::FORWARD)
     {
-      Slice *s_x = x.first_slice();
-      const Slice *s_v = v.first_slice();
+      Slice *s_x = x.slice(i0);
+      const Slice *s_v = v.slice(i0);
 
-      while(s_x != NULL)
+      for(int i = i0 ; s_x != NULL ; i++)
       {
         assert(s_v != NULL);
+        Interval outgate = s_x->output_gate();
         contract(*s_x, *s_v, t_propa);
+        i_last = i; // the backward propagation will start from there
+
+        if(i > i1 && s_x->output_gate() == outgate)
+          break; // no more forward propagation
+
         s_x = s_x->next_slice();
         s_v = s_v->next_slice();
       }
@@ -94,17 +106,24 @@ namespace codac
     
     if(t_propa & TimePropag::BACKWARD)
     {
-      Slice *s_x = x.last_slice();
-      const Slice *s_v = v.last_slice();
+      Slice *s_x = x.slice(i_last);
+      const Slice *s_v = v.slice(i_last);
 
-      while(s_x != NULL)
+      for(int i = i_last ; s_x != NULL ; i--)
       {
         assert(s_v != NULL);
+        Interval ingate = s_x->input_gate();
         contract(*s_x, *s_v, t_propa);
+
+        if(i < i0 && s_x->input_gate() == ingate)
+          break; // no more backward propagation
+
         s_x = s_x->prev_slice();
         s_v = s_v->prev_slice();
       }
     }
+
+    save_epoch({ &x, &v });
   }
 
   void CtcDeriv::contract(TubeVector& x, const TubeVector& v, TimePropag t_propa)
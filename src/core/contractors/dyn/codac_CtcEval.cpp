@@ -123,9 +123,6 @@ namespace codac
 
         y.remove_gate(t);
         w.remove_gate(t);
-
-        y.delete_synthesis_tree(); // todo: update tree if created, instead of delete
-        w.delete_synthesis_tree(); // todo: update tree if created, instead of delete
     }
 
     if(z.is_empty() || y.is_empty())
@@ -295,9 +292,6 @@ namespace codac
 
               y.remove_gate(v_gates_to_remove[i]);
               w.remove_gate(v_gates_to_remove[i]);
-
-              y.delete_synthesis_tree(); // todo: update tree if created, instead of delete
-              w.delete_synthesis_tree(); // todo: update tree if created, instead of delete
           }
       }
 
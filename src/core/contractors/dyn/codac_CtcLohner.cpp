@@ -10,6 +10,7 @@
 
 #include "codac_CtcLohner.h"
 
+#include <utility>
 #include <codac_CtcLohner.h>
 #include <Eigen/QR>
 #include <ibex.h>
@@ -241,7 +242,7 @@ void CtcLohner::contract(codac::Tube &tube, TimePropag t_propa) {
   assert(!tube.is_empty());
   codac::TubeVector tubeVector(1, tube);
   contract(tubeVector, t_propa);
-  tube = tubeVector[0];
+  tube = std::move(tubeVector[0]);
 }
 
 // Static members for contractor signature (mainly used for CN Exceptions)
@@ -76,107 +76,61 @@ namespace codac
   {
     assert(x.size()+m_dynamic_ctc == m_static_ctc.nb_var);
 
-    Slice **v_x_slices = new Slice*[x.size()];
+    vector<Tube*> v_x(x.size());
     for(int i = 0 ; i < x.size() ; i++)
-      v_x_slices[i] = x[i].first_slice();
+      v_x[i] = &x[i];
 
-    contract(v_x_slices, x.size());
-    delete v_x_slices;
+    contract_tubes(v_x);
   }
 
   void CtcStatic::contract(Tube& x1)
   {
-    int n = 1;
-    assert(n+m_dynamic_ctc == m_static_ctc.nb_var);
+    assert(1+m_dynamic_ctc == m_static_ctc.nb_var);
 
-    Slice **v_x_slices = new Slice*[n];
-    v_x_slices[0] = x1.first_slice();
-
-    contract(v_x_slices, n);
-    delete v_x_slices;
+    contract_tubes({ &x1 });
   }
 
   void CtcStatic::contract(Tube& x1, Tube& x2)
   {
-    int n = 2;
-    assert(n+m_dynamic_ctc == m_static_ctc.nb_var);
-
-    Slice **v_x_slices = new Slice*[n];
-    v_x_slices[0] = x1.first_slice();
-    v_x_slices[1] = x2.first_slice();
+    assert(2+m_dynamic_ctc == m_static_ctc.nb_var);
 
-    contract(v_x_slices, n);
-    delete v_x_slices;
+    contract_tubes({ &x1, &x2 });
   }
 
   void CtcStatic::contract(Tube& x1, Tube& x2, Tube& x3)
   {
-    int n = 3;
-    assert(n+m_dynamic_ctc == m_static_ctc.nb_var);
+    assert(3+m_dynamic_ctc == m_static_ctc.nb_var);
 
-    Slice **v_x_slices = new Slice*[n];
-    v_x_slices[0] = x1.first_slice();
-    v_x_slices[1] = x2.first_slice();
-    v_x_slices[2] = x3.first_slice();
-
-    contract(v_x_slices, n);
-    delete v_x_slices;
+    contract_tubes({ &x1, &x2, &x3 });
   }
 
   void CtcStatic::contract(Tube& x1, Tube& x2, Tube& x3, Tube& x4)
   {
-    int n = 4;
-    assert(n+m_dynamic_ctc == m_static_ctc.nb_var);
-
-    Slice **v_x_slices = new Slice*[n];
-    v_x_slices[0] = x1.first_slice();
-    v_x_slices[1] = x2.first_slice();
-    v_x_slices[2] = x3.first_slice();
-    v_x_slices[3] = x4.first_slice();
+    assert(4+m_dynamic_ctc == m_static_ctc.nb_var);
 
-    contract(v_x_slices, n);
-    delete v_x_slices;
+    contract_tubes({ &x1, &x2, &x3, &x4 });
   }
 
   void CtcStatic::contract(Tube& x1, Tube& x2, Tube& x3, Tube& x4, Tube& x5)
   {
-    int n = 5;
-    assert(n+m_dynamic_ctc == m_static_ctc.nb_var);
-
-    Slice **v_x_slices = new Slice*[n];
-    v_x_slices[0] = x1.first_slice();
-    v_x_slices[1] = x2.first_slice();
-    v_x_slices[2] = x3.first_slice();
-    v_x_slices[3] = x4.first_slice();
-    v_x_slices[4] = x5.first_slice();
-
-    contract(v_x_slices, n);
-    delete v_x_slices;
+    assert(5+m_dynamic_ctc == m_static_ctc.nb_var);
+
+    contract_tubes({ &x1, &x2, &x3, &x4, &x5 });
   }
 
   void CtcStatic::contract(Tube& x1, Tube& x2, Tube& x3, Tube& x4, Tube& x5, Tube& x6)
   {
-    int n = 6;
-    assert(n+m_dynamic_ctc == m_static_ctc.nb_var);
-
-    Slice **v_x_slices = new Slice*[n];
-    v_x_slices[0] = x1.first_slice();
-    v_x_slices[1] = x2.first_slice();
-    v_x_slices[2] = x3.first_slice();
-    v_x_slices[3] = x4.first_slice();
-    v_x_slices[4] = x5.first_slice();
-    v_x_slices[5] = x6.first_slice();
-
-    contract(v_x_slices, n);
-    delete v_x_slices;
+    assert(6+m_dynamic_ctc == m_static_ctc.nb_var);
+
+    contract_tubes({ &x1, &x2, &x3, &x4, &x5, &x6 });
   }
 
-  void CtcStatic::contract(Slice **v_x_slices, int n)
+  void CtcStatic::contract(Slice **v_x_slices, int n, int nb_slices)
   {
     IntervalVector envelope(n + m_dynamic_ctc);
     IntervalVector ingate(n + m_dynamic_ctc);
 
-    while(v_x_slices[0] != NULL)
+    for(int k = 0 ; v_x_slices[0] != NULL && k != nb_slices ; k++)
     {
       // If these slices should not be impacted by the contractor
       if(!v_x_slices[0]->tdomain().intersects(m_restricted_tdomain))
@@ -235,4 +189,24 @@ namespace codac
           v_x_slices[i] = v_x_slices[i]->next_slice();
     }
   }
-}
\ No newline at end of file
+
+  void CtcStatic::contract_tubes(const vector<Tube*>& v_x)
+  {
+    vector<const Tube*> v_const_x(v_x.begin(), v_x.end());
+
+    int i0, i1; // range of slices to be revisited (all of them, out of incremental mode)
+    if(!modified_slices(v_const_x, i0, i1))
+      return;
+
+    // The input gate of the next slice may have been written through this one
+    if(i1 < v_x[0]->nb_slices() - 1)
+      i1++;
+
+    vector<Slice*> v_x_slices(v_x.size());
+    for(size_t i = 0 ; i < v_x.size() ; i++)
+      v_x_slices[i] = v_x[i]->slice(i0);
+
+    contract(v_x_slices.data(), v_x.size(), i1 - i0 + 1);
+    save_epoch(v_const_x);
+  }
+}
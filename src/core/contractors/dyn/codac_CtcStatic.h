@@ -117,11 +117,20 @@ namespace codac
        *
        * \param v_x_slices the slices to be contracted
        * \param n the dimension of the array
+       * \param nb_slices the number of consecutive slices to be contracted (all the next ones if negative)
        */
-      void contract(Slice **v_x_slices, int n);
+      void contract(Slice **v_x_slices, int n, int nb_slices = -1);
 
     protected:
 
+      /**
+       * \brief Contracts a set of tubes of same slicing, over their modified slices
+       *        in incremental mode (see DynCtc::set_incremental_mode())
+       *
+       * \param v_x the tubes to be contracted
+       */
+      void contract_tubes(const std::vector<Tube*>& v_x);
+
       Ctc& m_static_ctc; //!< related static contractor
       int m_dynamic_ctc; //!< specifies either the temporal tdomain is part of the contraction or not
 
@@ -15,6 +15,8 @@ using namespace ibex;
 
 namespace codac
 {
+  const size_t DynCtc::s_max_nb_epochs = 64;
+
   DynCtc::DynCtc(bool intertemporal)
     : m_intertemporal(intertemporal)
   {
@@ -36,6 +38,12 @@ namespace codac
     m_fast_mode = fast_mode;
   }
 
+  void DynCtc::set_incremental_mode(bool incremental)
+  {
+    m_incremental_mode = incremental;
+    m_map_epochs.clear();
+  }
+
   void DynCtc::restrict_tdomain(const Interval& tdomain)
   {
     m_restricted_tdomain = tdomain;
@@ -45,4 +53,59 @@ namespace codac
   {
     return m_intertemporal;
   }
+
+  bool DynCtc::modified_slices(const vector<const Tube*>& v_x, int& first_slice_id, int& last_slice_id) const
+  {
+    assert(!v_x.empty());
+    first_slice_id = 0;
+    last_slice_id = v_x[0]->nb_slices() - 1;
+
+    if(!m_incremental_mode)
+      return true;
+
+    map<vector<const Tube*>,unsigned long>::const_iterator it = m_map_epochs.find(v_x);
+    if(it == m_map_epochs.end())
+      return true; // first contraction of these tubes
+
+    bool modified = false;
+    int i0 = last_slice_id, i1 = 0;
+
+    for(const Tube *x : v_x)
+    {
+      assert(x->nb_slices() == v_x[0]->nb_slices());
+      int k0, k1;
+      if(x->modified_slices(it->second, k0, k1))
+      {
+        modified = true;
+        i0 = std::min(i0, k0);
+        i1 = std::max(i1, k1);
+      }
+    }
+
+    first_slice_id = i0;
+    last_slice_id = i1;
+    return modified;
+  }
+
+  void DynCtc::save_epoch(const vector<const Tube*>& v_x)
+  {
+    if(!m_incremental_mode)
+      return;
+
+    unsigned long epoch = 0;
+    for(const Tube *x : v_x)
+      epoch = std::max(epoch, x->write_epoch());
+
+    if(m_map_epochs.size() >= s_max_nb_epochs && m_map_epochs.find(v_x) == m_map_epochs.end())
+    {
+      // The oldest contraction is forgotten (the tubes may not exist anymore)
+      map<vector<const Tube*>,unsigned long>::iterator it_oldest = m_map_epochs.begin();
+      for(map<vector<const Tube*>,unsigned long>::iterator it = m_map_epochs.begin() ; it != m_map_epochs.end() ; it++)
+        if(it->second < it_oldest->second)
+          it_oldest = it;
+      m_map_epochs.erase(it_oldest);
+    }
+
+    m_map_epochs[v_x] = epoch;
+  }
 }
\ No newline at end of file
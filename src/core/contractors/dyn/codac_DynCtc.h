@@ -12,6 +12,7 @@
 #ifndef __CODAC_DYNCTC_H__
 #define __CODAC_DYNCTC_H__
 
+#include <map>
 #include "codac_Tube.h"
 #include "codac_TubeVector.h"
 
@@ -99,6 +100,19 @@ namespace codac
        */
       void set_fast_mode(bool fast_mode = true);
 
+      /**
+       * \brief Specifies an optional incremental mode of contraction
+       *
+       * \note Contractions of tubes are then restricted to the slices modified since
+       *       the previous contraction of the same tubes by this contractor, plus the
+       *       slices reached by the propagation of these modifications.
+       *       Faster for local changes, but the result of a call may be less contracted
+       *       than a full sweep.
+       *
+       * \param incremental if true, incremental mode enabled
+       */
+      void set_incremental_mode(bool incremental = true);
+
       /**
        * \brief Limits the temporal domain of contractions
        *
@@ -115,9 +129,35 @@ namespace codac
 
     protected:
 
+      /**
+       * \brief Returns the range of slices to be contracted, that is the slices modified
+       *        since the last contraction of the same tubes (all the slices if the
+       *        incremental mode is disabled)
+       *
+       * \param v_x the tubes involved in the contraction, with the same slicing
+       * \param first_slice_id index of the first slice to be contracted
+       * \param last_slice_id index of the last slice to be contracted
+       * \return false if no slice has to be contracted
+       */
+      bool modified_slices(const std::vector<const Tube*>& v_x, int& first_slice_id, int& last_slice_id) const;
+
+      /**
+       * \brief Saves the current writing epoch of the tubes, once contracted
+       *        (only in incremental mode)
+       *
+       * \note When the epochs of too many sets of tubes are kept, the oldest one is
+       *       forgotten: the next contraction of these tubes will be a full sweep.
+       *
+       * \param v_x the tubes involved in the contraction
+       */
+      void save_epoch(const std::vector<const Tube*>& v_x);
+
       bool m_preserve_slicing = true; //!< if `true`, tube's slicing will not be affected by the contractor
       bool m_fast_mode = false; //!< some contractors may propose more pessimistic but faster execution modes
       Interval m_restricted_tdomain; //!< limits the contractions to the specified temporal domain
+      bool m_incremental_mode = false; //!< if `true`, only the modified slices are contracted
+      std::map<std::vector<const Tube*>,unsigned long> m_map_epochs; //!< epochs of the last contractions, for each set of tubes
+      static const size_t s_max_nb_epochs; //!< maximal number of sets of tubes for which the epochs are kept
       const bool m_intertemporal = true; //!< defines if the related constraint is inter-temporal or not (true by default)
   };
 }
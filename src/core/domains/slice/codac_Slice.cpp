@@ -22,11 +22,12 @@ namespace codac
     // Definition
 
     Slice::Slice(const Interval& tdomain, const Interval& codomain)
-      : m_tdomain(tdomain), m_codomain(codomain)
+      : m_tdomain(tdomain), m_codomain(codomain),
+        m_own_input_gate(codomain), m_own_output_gate(codomain)
     {
       assert(valid_tdomain(tdomain));
-      m_input_gate = new Interval(codomain);
-      m_output_gate = new Interval(codomain);
+      m_input_gate = &m_own_input_gate;
+      m_output_gate = &m_own_output_gate;
     }
 
     Slice::Slice(const Slice& x)
@@ -39,11 +40,14 @@ namespace codac
     {
       // Links to other slices are destroyed
       if(m_prev_slice != NULL) m_prev_slice->m_next_slice = NULL;
-      if(m_next_slice != NULL) m_next_slice->m_prev_slice = NULL;
+      if(m_next_slice != NULL)
+      {
+        m_next_slice->m_prev_slice = NULL;
 
-      // Gates are deleted if not shared with other slices
-      if(m_prev_slice == NULL) delete m_input_gate;
-      if(m_next_slice == NULL) delete m_output_gate;
+        // The shared gate is stored in this slice: its value is handed over
+        m_next_slice->m_own_input_gate = *m_output_gate;
+        m_next_slice->m_input_gate = &m_next_slice->m_own_input_gate;
+      }
     }
 
     int Slice::size() const
@@ -53,6 +57,9 @@ namespace codac
 
     const Slice& Slice::operator=(const Slice& x)
     {
+      if(m_tube_ref != NULL) // values shared with snapshots of the tube
+        m_tube_ref->before_slice_write(this);
+
       m_tdomain = x.m_tdomain;
       m_codomain = x.m_codomain;
       *m_input_gate = *x.m_input_gate;
@@ -63,7 +70,10 @@ namespace codac
         m_synthesis_reference->request_values_update();
         m_synthesis_reference->request_integrals_update();
       }
-      
+
+      if(m_tube_ref != NULL) // cached values of the tube
+        m_tube_ref->after_slice_write(this);
+
       return *this;
     }
     
@@ -442,6 +452,9 @@ namespace codac
 
     void Slice::set(const Interval& y)
     {
+      if(m_tube_ref != NULL) // values shared with snapshots of the tube
+        m_tube_ref->before_slice_write(this);
+
       m_codomain = y;
 
       *m_input_gate = y;
@@ -457,6 +470,9 @@ namespace codac
         m_synthesis_reference->request_values_update();
         m_synthesis_reference->request_integrals_update();
       }
+
+      if(m_tube_ref != NULL) // cached values of the tube
+        m_tube_ref->after_slice_write(this);
     }
     
     void Slice::set_empty()
@@ -466,6 +482,9 @@ namespace codac
 
     void Slice::set_envelope(const Interval& envelope, bool slice_consistency)
     {
+      if(m_tube_ref != NULL) // values shared with snapshots of the tube
+        m_tube_ref->before_slice_write(this);
+
       m_codomain = envelope;
 
       if(slice_consistency)
@@ -479,10 +498,16 @@ namespace codac
         m_synthesis_reference->request_values_update();
         m_synthesis_reference->request_integrals_update();
       }
+
+      if(m_tube_ref != NULL) // cached values of the tube
+        m_tube_ref->after_slice_write(this);
     }
 
     void Slice::set_input_gate(const Interval& input_gate, bool slice_consistency)
     {
+      if(m_tube_ref != NULL) // values shared with snapshots of the tube
+        m_tube_ref->before_slice_write(this);
+
       *m_input_gate = input_gate;
 
       if(slice_consistency)
@@ -497,10 +522,16 @@ namespace codac
         m_synthesis_reference->request_values_update();
         // Note: integrals are not impacted by gates
       }
+
+      if(m_tube_ref != NULL) // cached values of the tube
+        m_tube_ref->after_slice_write(this);
     }
 
     void Slice::set_output_gate(const Interval& output_gate, bool slice_consistency)
     {
+      if(m_tube_ref != NULL) // values shared with snapshots of the tube
+        m_tube_ref->before_slice_write(this);
+
       *m_output_gate = output_gate;
 
       if(slice_consistency)
@@ -515,6 +546,9 @@ namespace codac
         m_synthesis_reference->request_values_update();
         // Note: integrals are not impacted by gates
       }
+
+      if(m_tube_ref != NULL) // cached values of the tube
+        m_tube_ref->after_slice_write(this);
     }
     
     const Slice& Slice::inflate(double rad)
@@ -571,13 +605,12 @@ namespace codac
         if(second_slice->m_input_gate != NULL)
         {
           *first_slice->m_output_gate &= *second_slice->m_input_gate;
-          // todo: memory leak there? second_slice->m_input_gate should be deleted
         }
         second_slice->m_input_gate = first_slice->m_output_gate;
       }
     }
 
-    void Slice::merge_slices(Slice *first_slice, Slice *&second_slice)
+    void Slice::merge_slices(Slice *first_slice, Slice *second_slice)
     {
       assert(first_slice != NULL && second_slice != NULL);
       assert(first_slice->next_slice() == second_slice);
@@ -589,13 +622,11 @@ namespace codac
       first_slice->set_envelope(first_slice->codomain() | second_slice->codomain());
       first_slice->set_tdomain(first_slice->tdomain() | second_slice->tdomain());
 
-      // Deleting objects after fusion
-      first_slice->m_output_gate = new Interval(second_slice->output_gate());
+      // Unlinking the second slice after fusion (destroyed by the caller)
+      *first_slice->m_output_gate = second_slice->output_gate();
 
       second_slice->m_prev_slice = NULL;
       second_slice->m_next_slice = NULL;
-      delete second_slice; // will destroy both input/output gates because
-                           // pointers to neighbor slices have been set to NULL
 
       // Chaining slices
       first_slice->m_next_slice = next_slice_after_merge;
@@ -647,13 +647,14 @@ namespace codac
       /**
        * \brief Merges the two slices to keep only one
        *
-       * \note One slice object and gate will be removed during the operation.
+       * \note The second slice is unlinked from the structure but not destroyed:
+       *       its memory is owned by the related tube (see Tube::destroy_slice())
        *
        * \param first_slice a pointer to the first Slice object
        * \param second_slice a pointer to the second Slice object
        * \return void
        */
-      static void merge_slices(Slice *first_slice, Slice *&second_slice);
+      static void merge_slices(Slice *first_slice, Slice *second_slice);
 
       /**
        * \brief Returns the box \f$\llbracket x\rrbracket([t_0,t_f])\f$
@@ -668,9 +669,12 @@ namespace codac
 
         Interval m_tdomain; //!< temporal domain \f$[t_0,t_f]\f$ of the slice
         Interval m_codomain = Interval::ALL_REALS; //!< envelope of the slice
-        Interval *m_input_gate = NULL, *m_output_gate = NULL; //!< input and output gates
+        Interval m_own_input_gate, m_own_output_gate; //!< gates values, stored within the slice
+        Interval *m_input_gate = NULL, *m_output_gate = NULL; //!< input and output gates (the input one may point to the output gate of the previous slice)
         Slice *m_prev_slice = NULL, *m_next_slice = NULL; //!< pointers to previous and next slices of the related tube
         mutable TubeTreeSynthesis *m_synthesis_reference = NULL; //!< pointer to a leaf of the optional synthesis tree of the related tube
+        bool m_in_slab = false; //!< true if the slice has been constructed in a memory block of the related tube
+        const Tube *m_tube_ref = NULL; //!< pointer to the related tube, only set while it has to be notified of writings (snapshots, inversion index, aggregates)
 
       friend class Tube;
       friend class TubeTreeSynthesis;
@@ -0,0 +1,131 @@
+/**
+ *  SliceIndex class
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <cassert>
+#include <utility>
+#include "codac_SliceIndex.h"
+
+using namespace std;
+
+namespace codac
+{
+  // Public methods
+
+    size_t SliceIndex::size() const
+    {
+      return m_v.size() - m_head;
+    }
+
+    bool SliceIndex::empty() const
+    {
+      return m_v.size() == m_head;
+    }
+
+    Slice*& SliceIndex::operator[](size_t i)
+    {
+      assert(i < size());
+      return m_v[m_head + i];
+    }
+
+    Slice* const& SliceIndex::operator[](size_t i) const
+    {
+      assert(i < size());
+      return m_v[m_head + i];
+    }
+
+    Slice* SliceIndex::front() const
+    {
+      assert(!empty());
+      return m_v[m_head];
+    }
+
+    Slice* SliceIndex::back() const
+    {
+      assert(!empty());
+      return m_v.back();
+    }
+
+    SliceIndex::iterator SliceIndex::begin()
+    {
+      return m_v.begin() + m_head;
+    }
+
+    SliceIndex::iterator SliceIndex::end()
+    {
+      return m_v.end();
+    }
+
+    SliceIndex::const_iterator SliceIndex::begin() const
+    {
+      return m_v.begin() + m_head;
+    }
+
+    SliceIndex::const_iterator SliceIndex::end() const
+    {
+      return m_v.end();
+    }
+
+    void SliceIndex::push_back(Slice *s)
+    {
+      m_v.push_back(s);
+    }
+
+    void SliceIndex::pop_front()
+    {
+      assert(!empty());
+      m_head++;
+
+      // The cost of a compaction (moving the valid pointers) is amortized
+      // over the m_head removals that made it necessary
+      if(m_head > size())
+        compact();
+    }
+
+    SliceIndex::iterator SliceIndex::insert(iterator pos, Slice *s)
+    {
+      return m_v.insert(pos, s);
+    }
+
+    SliceIndex::iterator SliceIndex::erase(iterator pos)
+    {
+      return m_v.erase(pos);
+    }
+
+    void SliceIndex::reserve(size_t n)
+    {
+      m_v.reserve(m_head + n);
+    }
+
+    void SliceIndex::clear()
+    {
+      m_v.clear();
+      m_head = 0;
+    }
+
+    void SliceIndex::assign(vector<Slice*>&& v_slices)
+    {
+      m_v = std::move(v_slices);
+      m_head = 0;
+    }
+
+    void SliceIndex::swap(SliceIndex& x)
+    {
+      m_v.swap(x.m_v);
+      std::swap(m_head, x.m_head);
+    }
+
+  // Protected methods
+
+    void SliceIndex::compact()
+    {
+      m_v.erase(m_v.begin(), m_v.begin() + m_head); // the capacity is kept
+      m_head = 0;
+    }
+}
@@ -0,0 +1,157 @@
+/**
+ *  \file
+ *  SliceIndex class
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_SLICEINDEX_H__
+#define __CODAC_SLICEINDEX_H__
+
+#include <cstddef>
+#include <vector>
+
+namespace codac
+{
+  class Slice;
+
+  /**
+   * \class SliceIndex
+   * \brief Contiguous array of pointers to the slices of a tube, in temporal order
+   *
+   * Besides the usual operations of a vector, the first element can be removed
+   * in constant time: a head offset is moved, and the array is compacted only
+   * when the unused head is larger than the array itself. Appending and removing
+   * the first element are then both of amortized constant time, with no new
+   * allocation when a fixed number of elements is kept (as for sliding tubes).
+   */
+  class SliceIndex
+  {
+    public:
+
+      typedef std::vector<Slice*>::iterator iterator; //!< iterator over the pointers
+      typedef std::vector<Slice*>::const_iterator const_iterator; //!< const iterator over the pointers
+
+      /**
+       * \brief Returns the number of pointers
+       *
+       * \return the number of slices
+       */
+      size_t size() const;
+
+      /**
+       * \brief Tests whether the array is empty
+       *
+       * \return true if there is no slice
+       */
+      bool empty() const;
+
+      /**
+       * \brief Returns the i-th pointer
+       *
+       * \param i index of the slice
+       * \return a reference to the pointer
+       */
+      Slice*& operator[](size_t i);
+
+      /**
+       * \brief Returns the i-th pointer
+       *
+       * \param i index of the slice
+       * \return a const reference to the pointer
+       */
+      Slice* const& operator[](size_t i) const;
+
+      /**
+       * \brief Returns the first pointer
+       *
+       * \return the first slice
+       */
+      Slice* front() const;
+
+      /**
+       * \brief Returns the last pointer
+       *
+       * \return the last slice
+       */
+      Slice* back() const;
+
+      iterator begin(); //!< iterator on the first pointer
+      iterator end(); //!< iterator after the last pointer
+      const_iterator begin() const; //!< const iterator on the first pointer
+      const_iterator end() const; //!< const iterator after the last pointer
+
+      /**
+       * \brief Appends a pointer, in amortized constant time
+       *
+       * \param s the slice to be appended
+       */
+      void push_back(Slice *s);
+
+      /**
+       * \brief Removes the first pointer, in amortized constant time
+       */
+      void pop_front();
+
+      /**
+       * \brief Inserts a pointer before the given position
+       *
+       * \param pos iterator of this array
+       * \param s the slice to be inserted
+       * \return an iterator on the inserted pointer
+       */
+      iterator insert(iterator pos, Slice *s);
+
+      /**
+       * \brief Removes the pointer at the given position
+       *
+       * \param pos iterator of this array
+       * \return an iterator on the pointer following the removed one
+       */
+      iterator erase(iterator pos);
+
+      /**
+       * \brief Reserves memory for n pointers
+       *
+       * \param n expected number of slices
+       */
+      void reserve(size_t n);
+
+      /**
+       * \brief Removes all the pointers
+       */
+      void clear();
+
+      /**
+       * \brief Replaces the pointers by the ones of a vector
+       *
+       * \param v_slices pointers in temporal order, moved into this array
+       */
+      void assign(std::vector<Slice*>&& v_slices);
+
+      /**
+       * \brief Swaps the content of two arrays
+       *
+       * \param x the other SliceIndex
+       */
+      void swap(SliceIndex& x);
+
+    protected:
+
+      /**
+       * \brief Removes the unused head of the array
+       */
+      void compact();
+
+      // Class variables:
+
+        std::vector<Slice*> m_v; //!< pointers, the valid ones starting at m_head
+        size_t m_head = 0; //!< index in m_v of the first valid pointer
+  };
+}
+
+#endif
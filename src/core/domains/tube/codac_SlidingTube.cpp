@@ -0,0 +1,55 @@
+/**
+ *  SlidingTube class
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include "codac_SlidingTube.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace codac
+{
+  // Public methods
+
+    // Definition
+
+    SlidingTube::SlidingTube(double t0, double timestep, int capacity, const Interval& codomain)
+      : Tube(Interval(t0, t0 + timestep), codomain), m_capacity(capacity), m_window_timestep(timestep)
+    {
+      assert(timestep > 0.);
+      assert(capacity > 1);
+      enable_synthesis(false);
+    }
+
+    int SlidingTube::capacity() const
+    {
+      return m_capacity;
+    }
+
+    double SlidingTube::window_timestep() const
+    {
+      return m_window_timestep;
+    }
+
+    // Sliding window
+
+    Slice* SlidingTube::push_slice(const Interval& codomain)
+    {
+      bool evict = nb_slices() >= m_capacity; // the window may have been sampled in the meantime
+      if(evict && m_eviction_callback)
+        m_eviction_callback(*first_slice());
+
+      return push_back_slice(tdomain().ub() + m_window_timestep, codomain, evict);
+    }
+
+    void SlidingTube::set_eviction_callback(const function<void(const Slice&)>& callback)
+    {
+      m_eviction_callback = callback;
+    }
+}
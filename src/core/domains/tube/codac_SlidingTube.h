@@ -0,0 +1,86 @@
+/**
+ *  \file
+ *  SlidingTube class
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_SLIDINGTUBE_H__
+#define __CODAC_SLIDINGTUBE_H__
+
+#include <functional>
+#include "codac_Tube.h"
+
+namespace codac
+{
+  /**
+   * \class SlidingTube
+   * \brief One dimensional tube \f$[x](\cdot)\f$ restricted to a sliding
+   *        temporal window of a fixed number of slices
+   *
+   * New slices are appended at the end of the tube. Once the capacity is reached,
+   * the oldest slice is evicted for each new one, and its memory is reused: the
+   * memory usage remains constant over long online estimations.
+   *
+   * \note The synthesis tree is disabled for sliding tubes.
+   */
+  class SlidingTube : public Tube
+  {
+    public:
+
+      /**
+       * \brief Creates a sliding tube made of one slice \f$[t_0,t_0+\delta]\f$
+       *
+       * \param t0 lower bound of the temporal window
+       * \param timestep width \f$\delta\f$ of the slices
+       * \param capacity maximal number of slices of the window
+       * \param codomain Interval value of the first slice (all reals \f$[-\infty,\infty]\f$ by default)
+       */
+      explicit SlidingTube(double t0, double timestep, int capacity, const Interval& codomain = Interval::ALL_REALS);
+
+      /**
+       * \brief Returns the maximal number of slices of the window
+       *
+       * \return an integer
+       */
+      int capacity() const;
+
+      /**
+       * \brief Returns the width of the slices appended to the window
+       *
+       * \return the timestep \f$\delta\f$
+       */
+      double window_timestep() const;
+
+      /**
+       * \brief Appends a slice \f$[t_f,t_f+\delta]\f$ at the end of the window,
+       *        and evicts the oldest slice if the capacity is reached
+       *
+       * \note The eviction callback, if any, is called before the eviction
+       *
+       * \param codomain Interval value of the new slice (all reals \f$[-\infty,\infty]\f$ by default)
+       * \return a pointer to the new last slice
+       */
+      Slice* push_slice(const Interval& codomain = Interval::ALL_REALS);
+
+      /**
+       * \brief Defines a function called on each slice before its eviction,
+       *        for instance in order to log or serialize it
+       *
+       * \param callback function taking the evicted Slice object as argument
+       */
+      void set_eviction_callback(const std::function<void(const Slice&)>& callback);
+
+    protected:
+
+      int m_capacity; //!< maximal number of slices
+      double m_window_timestep; //!< width of the appended slices
+      std::function<void(const Slice&)> m_eviction_callback; //!< optional function called before evictions
+  };
+}
+
+#endif
@@ -0,0 +1,77 @@
+/**
+ *  SlidingTubeVector class
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <algorithm>
+#include "codac_SlidingTubeVector.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace codac
+{
+  // Public methods
+
+    // Definition
+
+    SlidingTubeVector::SlidingTubeVector(double t0, double timestep, int capacity, int n)
+      : SlidingTubeVector(t0, timestep, capacity, IntervalVector(n))
+    {
+
+    }
+
+    SlidingTubeVector::SlidingTubeVector(double t0, double timestep, int capacity, const IntervalVector& codomain)
+      : TubeVector(Interval(t0, t0 + timestep), codomain), m_capacity(capacity), m_window_timestep(timestep)
+    {
+      assert(timestep > 0.);
+      assert(capacity > 1);
+      for(int i = 0 ; i < size() ; i++)
+        (*this)[i].enable_synthesis(false);
+    }
+
+    int SlidingTubeVector::capacity() const
+    {
+      return m_capacity;
+    }
+
+    double SlidingTubeVector::window_timestep() const
+    {
+      return m_window_timestep;
+    }
+
+    // Sliding window
+
+    void SlidingTubeVector::push_slice(const IntervalVector& codomain)
+    {
+      assert(codomain.size() == size());
+
+      double t_ub = tdomain().ub() + m_window_timestep;
+      vector<bool> v_evict(size());
+
+      for(int i = 0 ; i < size() ; i++) // components may have been sampled in the meantime
+        v_evict[i] = (*this)[i].nb_slices() >= m_capacity;
+
+      if(m_eviction_callback && find(v_evict.begin(), v_evict.end(), true) != v_evict.end())
+      {
+        vector<const Slice*> v_slices(size(), NULL);
+        for(int i = 0 ; i < size() ; i++)
+          if(v_evict[i])
+            v_slices[i] = (*this)[i].first_slice();
+        m_eviction_callback(v_slices);
+      }
+
+      for(int i = 0 ; i < size() ; i++)
+        (*this)[i].push_back_slice(t_ub, codomain[i], v_evict[i]);
+    }
+
+    void SlidingTubeVector::set_eviction_callback(const function<void(const vector<const Slice*>&)>& callback)
+    {
+      m_eviction_callback = callback;
+    }
+}
@@ -0,0 +1,96 @@
+/**
+ *  \file
+ *  SlidingTubeVector class
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_SLIDINGTUBEVECTOR_H__
+#define __CODAC_SLIDINGTUBEVECTOR_H__
+
+#include <vector>
+#include <functional>
+#include "codac_TubeVector.h"
+
+namespace codac
+{
+  /**
+   * \class SlidingTubeVector
+   * \brief n-dimensional tube \f$[\mathbf{x}](\cdot)\f$ restricted to a sliding
+   *        temporal window of a fixed number of slices
+   *
+   * New slices are appended at the end of each component. Once the capacity is
+   * reached, the oldest slices are evicted for each new ones, and their memory is
+   * reused: the memory usage remains constant over long online estimations.
+   *
+   * \note The synthesis trees are disabled for sliding tubes.
+   */
+  class SlidingTubeVector : public TubeVector
+  {
+    public:
+
+      /**
+       * \brief Creates a n-dimensional sliding tube made of one slice \f$[t_0,t_0+\delta]\f$
+       *
+       * \param t0 lower bound of the temporal window
+       * \param timestep width \f$\delta\f$ of the slices
+       * \param capacity maximal number of slices of the window
+       * \param n dimension of this tube
+       */
+      explicit SlidingTubeVector(double t0, double timestep, int capacity, int n);
+
+      /**
+       * \brief Creates a n-dimensional sliding tube made of one slice \f$[t_0,t_0+\delta]\f$
+       *
+       * \param t0 lower bound of the temporal window
+       * \param timestep width \f$\delta\f$ of the slices
+       * \param capacity maximal number of slices of the window
+       * \param codomain IntervalVector value of the first slice
+       */
+      explicit SlidingTubeVector(double t0, double timestep, int capacity, const IntervalVector& codomain);
+
+      /**
+       * \brief Returns the maximal number of slices of the window
+       *
+       * \return an integer
+       */
+      int capacity() const;
+
+      /**
+       * \brief Returns the width of the slices appended to the window
+       *
+       * \return the timestep \f$\delta\f$
+       */
+      double window_timestep() const;
+
+      /**
+       * \brief Appends a slice \f$[t_f,t_f+\delta]\f$ at the end of each component
+       *        of the window, and evicts the oldest slices if the capacity is reached
+       *
+       * \note The eviction callback, if any, is called before the eviction
+       *
+       * \param codomain IntervalVector value of the new slices
+       */
+      void push_slice(const IntervalVector& codomain);
+
+      /**
+       * \brief Defines a function called on the first slices of the components
+       *        before their eviction, for instance in order to log or serialize them
+       *
+       * \param callback function taking the evicted Slice objects as argument (one per component)
+       */
+      void set_eviction_callback(const std::function<void(const std::vector<const Slice*>&)>& callback);
+
+    protected:
+
+      int m_capacity; //!< maximal number of slices
+      double m_window_timestep; //!< width of the appended slices
+      std::function<void(const std::vector<const Slice*>&)> m_eviction_callback; //!< optional function called before evictions
+  };
+}
+
+#endif
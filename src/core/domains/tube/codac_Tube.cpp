@@ -8,7 +8,13 @@
  *              the GNU Lesser General Public License (LGPL).
  */
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <new>
+#include <utility>
 #include "codac_Tube.h"
+#include "codac_TubeSnapshot.h"
 #include "codac_Exception.h"
 #include "codac_CtcDeriv.h"
 #include "codac_CtcEval.h"
@@ -35,10 +41,11 @@ namespace codac
       assert(valid_tdomain(tdomain));
 
       // By default, the tube is defined as one single slice
-      m_first_slice = new Slice(tdomain, codomain);
+      m_v_slices.push_back(new Slice(tdomain, codomain));
       
       // Redundant information for fast access
       m_tdomain = tdomain;
+      m_timestep = tdomain.diam();
     }
     
     Tube::Tube(const Interval& tdomain, double timestep, const Interval& codomain)
@@ -46,40 +53,8 @@ namespace codac
       assert(valid_tdomain(tdomain));
       assert(timestep >= 0.); // if 0., equivalent to no sampling
 
-      // Redundant information for fast access
-      m_tdomain = tdomain;
-
-      Slice *prev_slice = NULL, *slice;
-      double lb, ub = tdomain.lb();
-
-      if(timestep == 0.)
-        timestep = tdomain.diam();
-
-      do
-      {
-        lb = ub; // we guarantee all slices are adjacent
-        ub = std::min(lb + timestep, tdomain.ub()); // the tdomain of the last slice may be smaller
-
-        slice = new Slice(Interval(lb,ub));
-
-        if(prev_slice != NULL)
-        {
-          delete slice->m_input_gate;
-          slice->m_input_gate = NULL;
-          Slice::chain_slices(prev_slice, slice);
-        }
-
-        prev_slice = slice;
-        if(m_first_slice == NULL) m_first_slice = slice;
-        slice = slice->next_slice();
-
-      } while(ub < tdomain.ub());
-
-      if(codomain != Interval::ALL_REALS)
-        set(codomain);
-
-      if(m_enable_synthesis)
-        create_synthesis_tree();
+      // All the slices are allocated in a single memory block
+      create_slices(tdomain, timestep, codomain, allocate_slices(count_slices(tdomain, timestep)));
     }
     
     Tube::Tube(const Interval& tdomain, double timestep, const TFnc& f, int f_image_id)
@@ -92,7 +67,8 @@ namespace codac
 
       // A scalar copy of this is sent anyway in order to know the data structure to produce
       TubeVector input(1, *this);
-      *this = f.eval_vector(input)[f_image_id];
+      TubeVector output = f.eval_vector(input);
+      *this = std::move(output[f_image_id]);
     }
     
     Tube::Tube(const vector<Interval>& v_tdomains, const vector<Interval>& v_codomains)
@@ -100,26 +76,53 @@ namespace codac
       assert(v_tdomains.size() == v_codomains.size());
       assert(!v_tdomains.empty());
 
-      Interval tube_tdomain = Interval::EMPTY_SET;
+      vector<double> v_gates_t;
+      v_gates_t.reserve(v_tdomains.size() + 1);
+      v_gates_t.push_back(v_tdomains[0].lb());
+
       for(size_t i = 0 ; i < v_tdomains.size() ; i++)
       {
         assert(valid_tdomain(v_tdomains[i]));
         if(i > 0) assert(v_tdomains[i].lb() == v_tdomains[i-1].ub()); // domains continuity
-        tube_tdomain |= v_tdomains[i];
+        v_gates_t.push_back(v_tdomains[i].ub());
       }
 
-      m_first_slice = new Slice(tube_tdomain, Interval::ALL_REALS);
-      Slice *s = m_first_slice;
+      create_slices(v_gates_t);
 
-      for(size_t i = 0 ; i < v_tdomains.size() ; i++)
+      for(size_t i = 0 ; i < v_codomains.size() ; i++)
+        m_v_slices[i]->set_envelope(v_codomains[i]);
+    }
+
+    Tube::Tube(const vector<double>& v_gates_t, const Interval& codomain)
+    {
+      create_slices(v_gates_t);
+
+      if(codomain != Interval::ALL_REALS)
+        set(codomain);
+
+      if(m_enable_synthesis)
+        create_synthesis_tree();
+    }
+
+    Tube::Tube(const vector<double>& v_gates_t, const vector<Interval>& v_codomains, const vector<Interval>& v_gates)
+    {
+      assert(v_codomains.size() + 1 == v_gates_t.size());
+      assert(v_gates.empty() || v_gates.size() == v_gates_t.size());
+
+      create_slices(v_gates_t);
+
+      for(size_t i = 0 ; i < v_codomains.size() ; i++)
+        m_v_slices[i]->set_envelope(v_codomains[i]);
+
+      if(!v_gates.empty())
       {
-        sample(v_tdomains[i].ub(), s);
-        s->set_envelope(v_codomains[i]);
-        s = s->next_slice();
+        for(size_t i = 0 ; i < v_codomains.size() ; i++)
+          m_v_slices[i]->set_input_gate(v_gates[i]);
+        last_slice()->set_output_gate(v_gates.back());
       }
-      
-      // Redundant information for fast access
-      m_tdomain = tube_tdomain;
+
+      if(m_enable_synthesis)
+        create_synthesis_tree();
     }
 
     Tube::Tube(const Tube& x)
@@ -127,6 +130,11 @@ namespace codac
       *this = x;
     }
 
+    Tube::Tube(Tube&& x) noexcept
+    {
+      *this = std::move(x);
+    }
+
     Tube::Tube(const Tube& x, const TFnc& f, int f_image_id)
       : Tube(x)
     {
@@ -135,24 +143,69 @@ namespace codac
 
       // A scalar copy of this is sent anyway in order to know the data structure to produce
       TubeVector input(1, *this);
-      *this = f.eval_vector(input)[f_image_id];
+      TubeVector output = f.eval_vector(input);
+      *this = std::move(output[f_image_id]);
+    }
+
+    Tube::Tube(const Tube& x, const function<Interval(const Interval&)>& f)
+    {
+      int n = x.nb_slices();
+      copy_slices(x, allocate_slices(n), [&f,n](Slice *s, int k)
+      {
+        s->m_codomain = f(s->m_codomain);
+        *s->m_input_gate = f(*s->m_input_gate); // gates shared with the previous slice are not evaluated yet
+        if(k == n - 1)
+          *s->m_output_gate = f(*s->m_output_gate);
+      });
+    }
+
+    Tube::Tube(const Tube& x1, const Tube& x2, const function<Interval(const Interval&,const Interval&)>& f)
+    {
+      assert(same_slicing(x1, x2));
+
+      int n = x1.nb_slices();
+      copy_slices(x1, allocate_slices(n), [&f,&x2,n](Slice *s, int k)
+      {
+        const Slice *s2 = x2.m_v_slices[k];
+        s->m_codomain = f(s->m_codomain, s2->codomain());
+        *s->m_input_gate = f(*s->m_input_gate, s2->input_gate());
+        if(k == n - 1)
+          *s->m_output_gate = f(*s->m_output_gate, s2->output_gate());
+      });
+    }
+
+    Tube::Tube(const Tube& x, const IntervalArray& v)
+    {
+      int n = x.nb_slices();
+      assert(v.size() == 2 * n + 1);
+
+      copy_slices(x, allocate_slices(n), [&v,n](Slice *s, int k)
+      {
+        *s->m_input_gate = v[2 * k];
+        s->m_codomain = v[2 * k + 1];
+        if(k == n - 1)
+          *s->m_output_gate = v[2 * n];
+      });
     }
 
     Tube::Tube(const Trajectory& traj, double timestep)
-      : Tube(traj.tdomain(), timestep)
     {
       assert(timestep >= 0.); // if 0., equivalent to no sampling
-      set_empty();
-      *this |= traj;
+
+      // Slices and values are computed in the same pass
+      const Interval tdomain = traj.tdomain();
+      create_slices(tdomain, timestep, Interval::ALL_REALS,
+        allocate_slices(count_slices(tdomain, timestep)), trajectories_sweep({ &traj }));
     }
 
     Tube::Tube(const Trajectory& lb, const Trajectory& ub, double timestep)
-      : Tube(lb.tdomain(), timestep)
     {
       assert(timestep >= 0.); // if 0., equivalent to no sampling
       assert(lb.tdomain() == ub.tdomain());
-      set_empty();
-      *this |= lb; *this |= ub;
+
+      const Interval tdomain = lb.tdomain();
+      create_slices(tdomain, timestep, Interval::ALL_REALS,
+        allocate_slices(count_slices(tdomain, timestep)), trajectories_sweep({ &lb, &ub }));
     }
 
     Tube::Tube(const string& binary_file_name)
@@ -172,14 +225,7 @@ namespace codac
     Tube::~Tube()
     {
       delete_synthesis_tree();
-
-      Slice *slice = first_slice();
-      while(slice != NULL)
-      {
-        Slice *next_slice = slice->next_slice();
-        delete slice;
-        slice = next_slice;
-      }
+      release_slices();
     }
 
     int Tube::size() const
@@ -187,7 +233,7 @@ namespace codac
       return 1; // scalar object
     }
 
-    const Tube Tube::primitive(const Interval& c) const
+    Tube Tube::primitive(const Interval& c) const
     {
       Tube primitive(*this); // same slicing
       primitive.set(Interval::ALL_REALS); // initialized to [-oo,oo]
@@ -199,52 +245,47 @@ namespace codac
 
     const Tube& Tube::operator=(const Tube& x)
     {
-      // Destroying already existing structure
+      if(this == &x)
+        return *this;
 
-        Slice *prev_slice, *slice = first_slice();
-        while(slice != NULL)
-        {
-          Slice *next_slice = slice->next_slice();
-          delete slice;
-          slice = next_slice;
-        }
+      // Destroying already existing structure
 
         delete_synthesis_tree();
+        release_slices();
       
-      // Creating new structure
+      // Creating new structure, in a single memory block
 
-        prev_slice = NULL; slice = NULL;
+        copy_slices(x, allocate_slices(x.nb_slices()));
 
-        for(const Slice *s = x.first_slice() ; s != NULL ; s = s->next_slice())
-        {
-          if(slice == NULL)
-          {
-            slice = new Slice(*s);
-            m_first_slice = slice;
-          }
-
-          else
-          {
-            slice->m_next_slice = new Slice(*s);
-            slice = slice->next_slice();
-          }
+      return *this;
+    }
 
-          if(prev_slice != NULL)
-          {
-            delete slice->m_input_gate;
-            slice->m_input_gate = NULL;
-            Slice::chain_slices(prev_slice, slice);
-          }
+    const Tube& Tube::operator=(Tube&& x) noexcept
+    {
+      if(this == &x)
+        return *this;
 
-          prev_slice = slice;
-        }
+      // The contents of the two tubes are exchanged, with no allocation nor copy:
+      // the former slices of this tube (and their snapshots) are released with x
 
-        // Redundant information for fast access
-        m_tdomain = x.tdomain();
+        m_v_slices.swap(x.m_v_slices);
+        m_v_slabs.swap(x.m_v_slabs);
+        std::swap(m_timestep, x.m_timestep);
+        std::swap(m_nb_nonuniform_slices, x.m_nb_nonuniform_slices);
+        std::swap(m_synthesis_tree, x.m_synthesis_tree);
+        std::swap(m_enable_synthesis, x.m_enable_synthesis);
+        std::swap(m_tdomain, x.m_tdomain);
+        m_v_snapshots.swap(x.m_v_snapshots);
+        m_invert_index.swap(x.m_invert_index);
+        std::swap(m_track_slice_writes, x.m_track_slice_writes);
+        std::swap(m_aggregates, x.m_aggregates);
 
-      if(m_enable_synthesis)
-        create_synthesis_tree();
+        // Recorded writings are not exchanged: the values of both tubes have changed
+        m_v_chunk_epochs.clear();
+        x.m_v_chunk_epochs.clear();
 
+      update_references();
+      x.update_references();
       return *this;
     }
 
@@ -328,16 +369,7 @@ namespace codac
 
     int Tube::nb_slices() const
     {
-      if(m_synthesis_tree != NULL) // fast evaluation
-        return m_synthesis_tree->nb_slices();
-      
-      else
-      {
-        int size = 0;
-        for(const Slice *s = first_slice() ; s != NULL ; s = s->next_slice())
-          size ++;
-        return size;
-      }
+      return (int)m_v_slices.size();
     }
 
     Slice* Tube::slice(int slice_id)
@@ -347,25 +379,10 @@ namespace codac
 
     const Slice* Tube::slice(int slice_id) const
     {
-      if(slice_id < 0 && slice_id >= nb_slices())
+      if(slice_id < 0 || slice_id >= nb_slices())
         return NULL;
 
-      if(m_synthesis_tree != NULL) // fast access
-        return m_synthesis_tree->slice(slice_id);
-      
-      else
-      {
-        int i = 0;
-
-        for(const Slice *s = first_slice() ; s != NULL ; s = s->next_slice())
-        {
-          if(i == slice_id)
-            return s;
-          i++;
-        }
-
-        return NULL;
-      }
+      return m_v_slices[slice_id];
     }
 
     Slice* Tube::slice(double t)
@@ -378,22 +395,7 @@ namespace codac
       if(!tdomain().contains(t))
         return NULL;
 
-      if(m_synthesis_tree != NULL) // fast evaluation
-        return m_synthesis_tree->slice(t);
-      
-      else
-      {
-        const Slice *last_s = NULL;
-        for(const Slice *s = first_slice() ; s != NULL ; s = s->next_slice())
-        {
-          if(t < s->tdomain().ub())
-            return s;
-          last_s = s;
-        }
-        
-        assert(last_s != NULL);
-        return last_s;
-      }
+      return m_v_slices[time_to_index(t)];
     }
 
     Slice* Tube::first_slice()
@@ -403,7 +405,9 @@ namespace codac
 
     const Slice* Tube::first_slice() const
     {
-      return m_first_slice;
+      if(m_v_slices.empty())
+        return NULL;
+      return m_v_slices.front();
     }
 
     Slice* Tube::last_slice()
@@ -413,16 +417,9 @@ namespace codac
 
     const Slice* Tube::last_slice() const
     {
-      if(m_synthesis_tree != NULL) // fast evaluation
-        return m_synthesis_tree->slice(nb_slices() - 1);
-      
-      else
-      {
-        for(const Slice *s = first_slice() ; true ; s = s->next_slice())
-          if(s->next_slice() == NULL)
-            return s;
+      if(m_v_slices.empty())
         return NULL;
-      }
+      return m_v_slices.back();
     }
 
     Slice* Tube::wider_slice()
@@ -479,34 +476,75 @@ namespace codac
     {
       assert(tdomain().contains(t));
 
-      if(m_synthesis_tree != NULL) // fast evaluation
-        return m_synthesis_tree->time_to_index(t);
-      
-      else
+      int n = nb_slices();
+
+      if(m_nb_nonuniform_slices == 0) // uniform slicing: direct computation
       {
-        int i = -1;
-        for(const Slice *s = first_slice() ; s != NULL ; s = s->next_slice())
-        {
+        double i_ = (t - first_slice()->tdomain().lb()) / m_timestep;
+        int i = (int)std::min((double)(n - 1), std::max(0., i_));
+
+        // Gates may slightly differ from the theoretical grid due to
+        // floating-point accumulation: the guess is locally corrected
+        while(i > 0 && t < m_v_slices[i]->tdomain().lb())
+          i--;
+        while(i < n - 1 && t >= m_v_slices[i]->tdomain().ub())
           i++;
-          if(t < s->tdomain().ub())
-            return i;
-        }
-
         return i;
       }
+
+      else // binary search: first slice such that t < ub
+      {
+        SliceIndex::const_iterator it = upper_bound(m_v_slices.begin(), m_v_slices.end(), t,
+          [](double t, const Slice *s) { return t < s->tdomain().ub(); });
+
+        if(it == m_v_slices.end())
+          return n - 1; // t is the upper bound of the tdomain
+        return (int)(it - m_v_slices.begin());
+      }
     }
 
     int Tube::index(const Slice* slice) const
     {
-      int i = 0;
-      const Slice *it = first_slice();
-      while(it != NULL && it != slice)
+      // Slices are sorted by their tdomain: binary search
+      SliceIndex::const_iterator it = lower_bound(m_v_slices.begin(), m_v_slices.end(), slice,
+        [](const Slice *s, const Slice *x) { return s->tdomain().lb() < x->tdomain().lb(); });
+
+      if(it == m_v_slices.end() || *it != slice)
+        return -1; // not a slice of this tube
+      return (int)(it - m_v_slices.begin());
+    }
+
+    unsigned long Tube::write_epoch() const
+    {
+      if(m_v_chunk_epochs.empty()) // writings are recorded from a new epoch
+      {
+        m_v_chunk_epochs.assign((nb_slices() + s_epoch_chunk_size - 1) / s_epoch_chunk_size, ++s_write_epoch);
+        if(!m_track_slice_writes)
+          track_slice_writes(true);
+      }
+
+      return s_write_epoch.load();
+    }
+
+    bool Tube::modified_slices(unsigned long epoch, int& first_slice_id, int& last_slice_id) const
+    {
+      if(m_v_chunk_epochs.empty()) // writings not recorded
       {
-        it = it->next_slice();
-        if(it == NULL) return -1;
-        i++;
+        first_slice_id = 0;
+        last_slice_id = nb_slices() - 1;
+        return true;
       }
-      return i;
+
+      int c0 = 0, c1 = m_v_chunk_epochs.size() - 1;
+      while(c0 <= c1 && m_v_chunk_epochs[c0] <= epoch) c0++;
+      while(c1 >= c0 && m_v_chunk_epochs[c1] <= epoch) c1--;
+
+      if(c0 > c1)
+        return false;
+
+      first_slice_id = c0 * s_epoch_chunk_size;
+      last_slice_id = std::min((c1 + 1) * s_epoch_chunk_size, nb_slices()) - 1;
+      return true;
     }
 
     void Tube::sample(double t)
@@ -531,9 +569,11 @@ namespace codac
 
       else
       {
-        delete_synthesis_tree(); // todo: update tree if created, instead of delete
-
+        int i = index(slice_to_be_sampled);
+        assert(i != -1 && "the slice must belong to this tube");
+        before_slicing_change();
         Slice *next_slice = slice_to_be_sampled->next_slice();
+        m_nb_nonuniform_slices -= is_nonuniform_slice(slice_to_be_sampled);
 
         // Creating new slice
         Slice *new_slice = new Slice(*slice_to_be_sampled);
@@ -541,11 +581,15 @@ namespace codac
         slice_to_be_sampled->set_tdomain(Interval(slice_to_be_sampled->tdomain().lb(), t));
 
         // Updated slices structure
-        delete new_slice->m_input_gate;
         new_slice->m_input_gate = NULL;
         Slice::chain_slices(new_slice, next_slice);
         Slice::chain_slices(slice_to_be_sampled, new_slice);
         new_slice->set_input_gate(new_slice->codomain());
+        m_v_slices.insert(m_v_slices.begin() + i + 1, new_slice);
+        m_nb_nonuniform_slices += is_nonuniform_slice(slice_to_be_sampled) + is_nonuniform_slice(new_slice);
+
+        if(m_synthesis_tree != NULL) // local update of the tree
+          m_synthesis_tree = slice_to_be_sampled->m_synthesis_reference->sample(new_slice);
       }
     }
 
@@ -553,8 +597,6 @@ namespace codac
     {
       assert(tdomain().contains(t));
 
-      delete_synthesis_tree(); // todo: update tree if created, instead of delete
-
       sample(t);
       Slice *s = slice(t);
       if(t == s->tdomain().lb())
@@ -567,8 +609,85 @@ namespace codac
     {
       assert(tdomain() == x.tdomain());
 
+      vector<double> v_t;
+      v_t.reserve(x.nb_slices());
       for(const Slice *s = x.first_slice() ; s != NULL ; s = s->next_slice())
-        sample(s->tdomain().ub());
+        v_t.push_back(s->tdomain().ub());
+      sample(v_t);
+    }
+
+    void Tube::sample(const vector<double>& v_t)
+    {
+      assert(is_sorted(v_t.begin(), v_t.end()));
+
+      if(v_t.empty())
+        return;
+
+      assert(tdomain().contains(v_t.front()) && tdomain().contains(v_t.back()));
+
+      // Counting the new slices, so that they are allocated in a single memory block
+      int n = 0;
+      size_t i = 0;
+      for(const Slice *s = first_slice() ; s != NULL && i < v_t.size() ; s = s->next_slice())
+      {
+        double t_gate = s->tdomain().lb();
+        for( ; i < v_t.size() && v_t[i] < s->tdomain().ub() ; i++)
+          if(v_t[i] > t_gate) // not an already existing gate
+          {
+            t_gate = v_t[i];
+            n++;
+          }
+      }
+
+      if(n == 0)
+        return; // no effect
+
+      before_slicing_change();
+      bool synthesis = m_synthesis_tree != NULL;
+      delete_synthesis_tree(); // rebuilt once at the end
+
+      Slice *block = allocate_slices(n);
+      vector<Slice*> v_slices;
+      v_slices.reserve(m_v_slices.size() + n);
+      i = 0;
+
+      for(Slice *s : m_v_slices)
+      {
+        v_slices.push_back(s);
+        double t_ub = s->tdomain().ub();
+
+        for( ; i < v_t.size() && v_t[i] < t_ub ; i++)
+        {
+          Slice *slice_to_be_sampled = v_slices.back();
+          double t = v_t[i];
+          if(t <= slice_to_be_sampled->tdomain().lb())
+            continue; // the gate already exists
+
+          // Same splitting as for a single sampling
+          Slice *new_slice = new(block) Slice(*slice_to_be_sampled);
+          new_slice->m_in_slab = true;
+          block++;
+
+          new_slice->set_tdomain(Interval(t, t_ub));
+          slice_to_be_sampled->set_tdomain(Interval(slice_to_be_sampled->tdomain().lb(), t));
+
+          new_slice->m_input_gate = NULL;
+          Slice::chain_slices(new_slice, slice_to_be_sampled->next_slice());
+          Slice::chain_slices(slice_to_be_sampled, new_slice);
+          new_slice->set_input_gate(new_slice->codomain());
+          v_slices.push_back(new_slice);
+        }
+      }
+
+      m_v_slices.assign(std::move(v_slices));
+
+      // The reference width of the slicing is kept
+      m_nb_nonuniform_slices = 0;
+      for(const Slice *s : m_v_slices)
+        m_nb_nonuniform_slices += is_nonuniform_slice(s);
+
+      if(synthesis)
+        create_synthesis_tree();
     }
 
     bool Tube::gate_exists(double t) const
@@ -581,25 +700,112 @@ namespace codac
       assert(tdomain().contains(t));
       assert(t != tdomain().lb() && t != tdomain().ub() && "cannot remove initial/final gates");
 
-      Slice *s2 = slice(t);
+      int i = time_to_index(t);
+      Slice *s2 = slice(i);
       assert(s2->tdomain().lb() == t && "the gate must already exist");
       Slice *s1 = s2->prev_slice();
+      before_slicing_change();
 
+      if(m_synthesis_tree != NULL) // local update of the tree
+        m_synthesis_tree = s2->m_synthesis_reference->remove_leaf();
+
+      m_nb_nonuniform_slices -= is_nonuniform_slice(s1) + is_nonuniform_slice(s2);
       Slice::merge_slices(s1, s2);
+      destroy_slice(s2);
+      m_v_slices.erase(m_v_slices.begin() + i);
+      m_nb_nonuniform_slices += is_nonuniform_slice(s1);
+
+      if(m_synthesis_tree != NULL)
+        s1->m_synthesis_reference->request_structure_update();
     }
 
     void Tube::merge_similar_slices(double distance_threshold)
     {
-      Slice *s2 = first_slice();
-      while(s2 != NULL)
+      vector<bool> v_removed_gates;
+      if(select_similar_slices(distance_threshold, v_removed_gates) > 0)
+        remove_gates(v_removed_gates);
+    }
+
+    void Tube::adapt_slicing(int max_nb_slices, double distance_threshold)
+    {
+      assert(max_nb_slices > 0);
+      assert(distance_threshold >= 0.);
+
+      // Coarsening: merging nearly identical slices, then the most similar ones
+      // while the budget is exceeded
+
+      vector<bool> v_removed_gates;
+      int n = nb_slices() - select_similar_slices(distance_threshold, v_removed_gates);
+
+      if(n > max_nb_slices)
       {
-        Slice *s1 = s2->prev_slice();
-        Slice *next_slice = s2->next_slice();
+        // Codomains of the groups of slices already merged, the distances being
+        // computed between these groups on both sides of each remaining gate
 
-        if(s1 != NULL && distance(s1->codomain(),s2->codomain()) < distance_threshold)
-            Slice::merge_slices(s1, s2);
-      
-        s2 = next_slice;
+        vector<pair<Interval,int> > v_groups; // hull of the codomains, index of the first slice
+        v_groups.reserve(n);
+        int k = 0;
+        for(const Slice *s = first_slice() ; s ; s = s->next_slice(), k++)
+        {
+          if(k == 0 || !v_removed_gates[k])
+            v_groups.push_back(make_pair(s->codomain(), k));
+          else
+            v_groups.back().first |= s->codomain();
+        }
+
+        vector<pair<double,int> > v_gates_distances; // distance between the groups of each remaining gate
+        v_gates_distances.reserve(n - 1);
+        for(int g = 1 ; g < n ; g++)
+          v_gates_distances.push_back(make_pair(distance(v_groups[g-1].first, v_groups[g].first), v_groups[g].second));
+
+        int nb_removals = n - max_nb_slices;
+        nth_element(v_gates_distances.begin(), v_gates_distances.begin() + nb_removals - 1, v_gates_distances.end());
+        for(int i = 0 ; i < nb_removals ; i++)
+          v_removed_gates[v_gates_distances[i].second] = true;
+        n = max_nb_slices;
+      }
+
+      if(n < nb_slices())
+        remove_gates(v_removed_gates);
+
+      // Refining: bisecting the slices where the diameter of the codomain varies
+      // the most, within the remaining budget
+
+      if(n < max_nb_slices && n > 1)
+      {
+        vector<pair<double,int> > v_slices_variations; // variation of the diameter around each slice
+        v_slices_variations.reserve(n);
+        for(int k = 0 ; k < n ; k++)
+        {
+          double d = slice(k)->codomain().diam(), variation = 0.;
+          if(k > 0)
+            variation = std::max(variation, fabs(d - slice(k-1)->codomain().diam()));
+          if(k < n - 1)
+            variation = std::max(variation, fabs(d - slice(k+1)->codomain().diam()));
+
+          // Note: NaN differences (unbounded codomains) are ignored by std::max
+          double t = slice(k)->tdomain().mid();
+          if(variation > 0. && t > slice(k)->tdomain().lb() && t < slice(k)->tdomain().ub())
+            v_slices_variations.push_back(make_pair(variation, k));
+        }
+
+        int nb_bisections = std::min(max_nb_slices - n, (int)v_slices_variations.size());
+        if(nb_bisections > 0)
+        {
+          nth_element(v_slices_variations.begin(), v_slices_variations.begin() + nb_bisections - 1, v_slices_variations.end(),
+            [](const pair<double,int>& a, const pair<double,int>& b) { return a.first > b.first; });
+
+          vector<bool> v_bisected(n, false);
+          for(int i = 0 ; i < nb_bisections ; i++)
+            v_bisected[v_slices_variations[i].second] = true;
+
+          vector<double> v_t;
+          v_t.reserve(nb_bisections);
+          for(int k = 0 ; k < n ; k++)
+            if(v_bisected[k])
+              v_t.push_back(slice(k)->tdomain().mid());
+          sample(v_t);
+        }
       }
     }
 
@@ -610,16 +816,24 @@ namespace codac
       return codomain_box()[0];
     }
 
-    double Tube::volume() const
+    IntervalArray Tube::values() const
     {
-      double volume = 0.;
+      IntervalArray v(2 * nb_slices() + 1);
+
+      int i = 0;
+      v.set(i++, first_slice()->input_gate());
       for(const Slice *s = first_slice() ; s != NULL ; s = s->next_slice())
       {
-        if(s->volume() == POS_INFINITY)
-          return POS_INFINITY;
-        volume += s->volume();
+        v.set(i++, s->codomain());
+        v.set(i++, s->output_gate());
       }
-      return volume;
+
+      return v;
+    }
+
+    double Tube::volume() const
+    {
+      return aggregates().volume;
     }
 
     const Interval Tube::operator()(int slice_id) const
@@ -665,6 +879,20 @@ namespace codac
       }
     }
 
+    const vector<Interval> Tube::eval_batch(const vector<double>& v_t) const
+    {
+      vector<Interval> v_y(v_t.size());
+      eval_sorted_batch(v_t, batch_order(v_t), v_y);
+      return v_y;
+    }
+
+    const vector<Interval> Tube::eval_batch(const vector<Interval>& v_t) const
+    {
+      vector<Interval> v_y(v_t.size());
+      eval_sorted_batch(v_t, batch_order(v_t), v_y);
+      return v_y;
+    }
+
     const pair<Interval,Interval> Tube::eval(const Interval& t) const
     {
       if(m_synthesis_tree != NULL) // fast evaluation
@@ -744,14 +972,41 @@ namespace codac
 
         Interval invert = Interval::EMPTY_SET;
 
-        const Slice *s_x = slice(search_tdomain.lb());
-        while(s_x != NULL && s_x->tdomain().lb() < search_tdomain.ub())
+        if(y.is_empty() || search_tdomain.is_degenerated())
         {
-          invert |= s_x->invert(y, search_tdomain & s_x->tdomain());
-          s_x = s_x->next_slice();
+          const Slice *s_x = slice(search_tdomain.lb());
+          while(s_x != NULL && s_x->tdomain().lb() < search_tdomain.ub())
+          {
+            invert |= s_x->invert(y, search_tdomain & s_x->tdomain());
+            s_x = s_x->next_slice();
+          }
+
+          return invert;
         }
 
-        return invert;
+        // Fast inversion with the index: only the first and last
+        // slices of the pre-image are required to compute its hull
+
+        if(m_invert_index.empty())
+          build_invert_index();
+
+        int i0 = time_to_index(search_tdomain.lb()), i1 = time_to_index(search_tdomain.ub());
+        if(slice(i1)->tdomain().lb() == search_tdomain.ub())
+          i1--; // the slice only touches the search tdomain
+
+        for(int k = search_invert_index(y, i0, i1, true) ; k != -1 && invert.is_empty() ;
+            k = search_invert_index(y, k + 1, i1, true))
+          invert |= slice(k)->invert(y, search_tdomain & slice_tdomain(k));
+
+        if(invert.is_empty())
+          return invert;
+
+        Interval invert_ub = Interval::EMPTY_SET;
+        for(int k = search_invert_index(y, i0, i1, false) ; k != -1 && invert_ub.is_empty() ;
+            k = search_invert_index(y, i0, k - 1, false))
+          invert_ub |= slice(k)->invert(y, search_tdomain & slice_tdomain(k));
+
+        return invert | invert_ub;
       }
     }
 
@@ -774,28 +1029,77 @@ namespace codac
 
       Interval invert = Interval::EMPTY_SET;
 
-      const Slice *s_x = slice(search_tdomain.lb());
-      while(s_x != NULL && s_x->tdomain().lb() <= search_tdomain.ub())
+      if(y.is_empty() || search_tdomain.is_degenerated())
       {
-        Interval local_invert = s_x->invert(y, search_tdomain & s_x->tdomain());
-        if(local_invert.is_empty() && !invert.is_empty())
+        const Slice *s_x = slice(search_tdomain.lb());
+        while(s_x != NULL && s_x->tdomain().lb() <= search_tdomain.ub())
         {
-          v_t.push_back(invert);
-          invert.set_empty();
-        }
+          Interval local_invert = s_x->invert(y, search_tdomain & s_x->tdomain());
+          if(local_invert.is_empty() && !invert.is_empty())
+          {
+            v_t.push_back(invert);
+            invert.set_empty();
+          }
 
-        else
-          invert |= local_invert;
+          else
+            invert |= local_invert;
 
-        s_x = s_x->next_slice();
+          s_x = s_x->next_slice();
+        }
       }
 
-      if(!invert.is_empty())
-        v_t.push_back(invert);
-    }
+      else
+      {
+        // Fast inversion with the index: only the candidate slices are
+        // visited, consecutive pre-images being merged
 
-    const Interval Tube::invert(const Interval& y, const Tube& v, const Interval& search_tdomain) const
-    {
+        if(m_invert_index.empty())
+          build_invert_index();
+
+        int i0 = time_to_index(search_tdomain.lb()), i1 = time_to_index(search_tdomain.ub());
+        const Slice *s_ub = NULL; // slice only touching the search tdomain, at its upper bound
+        if(slice(i1)->tdomain().lb() == search_tdomain.ub())
+          s_ub = slice(i1--);
+
+        int prev_k = -2;
+        for(int k = search_invert_index(y, i0, i1, true) ; k != -1 ; k = search_invert_index(y, k + 1, i1, true))
+        {
+          Interval local_invert = slice(k)->invert(y, search_tdomain & slice_tdomain(k));
+          if(local_invert.is_empty())
+            continue;
+
+          if(k != prev_k + 1 && !invert.is_empty())
+          {
+            v_t.push_back(invert);
+            invert.set_empty();
+          }
+
+          invert |= local_invert;
+          prev_k = k;
+        }
+
+        if(s_ub != NULL)
+        {
+          Interval local_invert = s_ub->invert(y, Interval(search_tdomain.ub()));
+          if(!local_invert.is_empty())
+          {
+            if(i1 != prev_k && !invert.is_empty())
+            {
+              v_t.push_back(invert);
+              invert.set_empty();
+            }
+
+            invert |= local_invert;
+          }
+        }
+      }
+
+      if(!invert.is_empty())
+        v_t.push_back(invert);
+    }
+
+    const Interval Tube::invert(const Interval& y, const Tube& v, const Interval& search_tdomain) const
+    {
       assert(tdomain() == v.tdomain());
       assert(same_slicing(*this, v));
 
@@ -864,13 +1168,12 @@ namespace codac
 
     double Tube::max_diam() const
     {
-      const Slice *largest = largest_slice();
-
-      if(largest->codomain().is_unbounded())
-        return numeric_limits<double>::infinity();
+      return aggregates().max_diam;
+    }
 
-      else
-        return largest->codomain().diam();
+    double Tube::sum_gates_diam() const
+    {
+      return aggregates().sum_gates_diam;
     }
 
     double Tube::max_gate_diam(double& t) const
@@ -1121,6 +1424,21 @@ namespace codac
       return *this;
     }
 
+    const Tube& Tube::set_values(const IntervalArray& v)
+    {
+      assert(v.size() == 2 * nb_slices() + 1);
+
+      int i = 0;
+      for(Slice *s = first_slice() ; s != NULL ; s = s->next_slice())
+      {
+        s->set_input_gate(v[i++], false);
+        s->set_envelope(v[i++], false);
+      }
+
+      last_slice()->set_output_gate(v[i], false);
+      return *this;
+    }
+
     const Tube& Tube::set(const Interval& y, double t)
     {
       assert(tdomain().contains(t));
@@ -1206,38 +1524,44 @@ namespace codac
       assert(valid_tdomain(t));
       assert(tdomain().is_superset(t));
 
+      before_slicing_change();
+      delete_synthesis_tree(); // todo: update tree if created, instead of delete
+
       // The first slice is the slice containing t.lb()
-      while(!m_first_slice->tdomain().contains(t.lb()))
+      Slice *s_first = first_slice();
+      while(!s_first->tdomain().contains(t.lb()))
       {
-        Slice *s_next = m_first_slice->next_slice();
-        delete m_first_slice;
-        m_first_slice = s_next;
+        Slice *s_next = s_first->next_slice();
+        destroy_slice(s_first);
+        s_first = s_next;
       }
 
-      m_first_slice->set_tdomain(t & m_first_slice->tdomain());
+      s_first->set_tdomain(t & s_first->tdomain());
 
       // After this iteration, the last slice will be the one containing t.ub()
       Slice *s_last = last_slice();
       while(!s_last->tdomain().contains(t.ub()))
       {
         Slice *s_prev = s_last->prev_slice();
-        delete s_last;
+        destroy_slice(s_last);
         s_last = s_prev;
       }
 
       s_last->set_tdomain(t & s_last->tdomain());
 
       m_tdomain = t;
-      delete_synthesis_tree(); // todo: update tree if created, instead of delete
+      rebuild_slices_index(s_first);
       return *this;
     }
 
     void Tube::shift_tdomain(double shift_ref)
     {
+      before_slicing_change();
       for(Slice *s = first_slice() ; s != NULL ; s = s->next_slice())
         s->shift_tdomain(shift_ref);
       m_tdomain += shift_ref;
       delete_synthesis_tree();
+      update_slicing_uniformity();
     }
 
     // Bisection
@@ -1283,6 +1607,9 @@ namespace codac
     #else
     bool Tube::s_enable_syntheses = false;
     #endif
+
+    std::atomic<unsigned long> Tube::s_write_epoch(0);
+    const int Tube::s_epoch_chunk_size = 32;
     
     void Tube::enable_syntheses(bool enable)
     {
@@ -1477,11 +1804,106 @@ namespace codac
         return m_synthesis_tree->codomain();
       
       else
+        return IntervalVector(1, aggregates().codomain);
+    }
+
+    const Tube::Aggregates& Tube::aggregates() const
+    {
+      Aggregates& a = m_aggregates;
+
+      if(!a.valid) // sums and extrema, computed in one pass
       {
-        IntervalVector codomain(1, Interval::EMPTY_SET);
+        a.bounded_volume = 0.;
+        a.bounded_gates_diam = 0.;
+        a.nb_unbounded_volumes = 0;
+        a.nb_unbounded_gates = 0;
+        a.valid_extrema = false;
+
+        if(!m_v_slices.empty())
+        {
+          double d = first_slice()->input_gate().diam();
+          if(d == POS_INFINITY)
+            a.nb_unbounded_gates++;
+          else
+            a.bounded_gates_diam += d;
+        }
+
         for(const Slice *s = first_slice() ; s != NULL ; s = s->next_slice())
-          codomain |= s->codomain_box();
-        return codomain;
+        {
+          double v = s->volume(), d = s->output_gate().diam();
+
+          if(v == POS_INFINITY)
+            a.nb_unbounded_volumes++;
+          else
+            a.bounded_volume += v;
+
+          if(d == POS_INFINITY)
+            a.nb_unbounded_gates++;
+          else
+            a.bounded_gates_diam += d;
+        }
+
+        a.max_bounded_volume = a.bounded_volume;
+        a.max_bounded_gates_diam = a.bounded_gates_diam;
+        a.nb_updates = 0;
+        a.valid = true;
+      }
+
+      if(!a.valid_extrema)
+      {
+        a.max_diam = 0.;
+        a.codomain = Interval::EMPTY_SET;
+
+        for(const Slice *s = first_slice() ; s != NULL ; s = s->next_slice())
+        {
+          const Interval y = s->codomain();
+          a.codomain |= y;
+          a.max_diam = std::max(a.max_diam, y.is_unbounded() ? POS_INFINITY : y.diam());
+        }
+
+        a.valid_extrema = true;
+      }
+
+      a.volume = a.nb_unbounded_volumes > 0 ? POS_INFINITY : a.bounded_volume;
+      a.sum_gates_diam = a.nb_unbounded_gates > 0 ? POS_INFINITY : a.bounded_gates_diam;
+
+      if(!m_track_slice_writes) // the values are updated by the next writings
+        track_slice_writes(true);
+      return a;
+    }
+
+    void Tube::update_aggregates(const Slice *s, int sign) const
+    {
+      assert(sign == 1 || sign == -1);
+      Aggregates& a = m_aggregates;
+      assert(a.valid);
+
+      double v = s->volume();
+      if(v == POS_INFINITY)
+        a.nb_unbounded_volumes += sign;
+      else
+        a.bounded_volume += sign * v;
+
+      for(double d : { s->input_gate().diam(), s->output_gate().diam() })
+      {
+        if(d == POS_INFINITY)
+          a.nb_unbounded_gates += sign;
+        else
+          a.bounded_gates_diam += sign * d;
+      }
+
+      if(sign > 0)
+      {
+        a.max_bounded_volume = std::max(a.max_bounded_volume, a.bounded_volume);
+        a.max_bounded_gates_diam = std::max(a.max_bounded_gates_diam, a.bounded_gates_diam);
+        a.nb_updates++;
+
+        // Rounding errors of the incremental sums remain small compared to
+        // the sums, otherwise they are computed again (amortized constant time)
+        if(a.nb_updates > nb_slices()
+          || a.bounded_volume < 0.5 * a.max_bounded_volume
+          || a.bounded_gates_diam < 0.5 * a.max_bounded_gates_diam)
+          a.valid = false;
       }
     }
 
@@ -1519,10 +1941,7 @@ namespace codac
       m_enable_synthesis = true;
       delete_synthesis_tree();
 
-      vector<const Slice*> v_slices;
-      for(const Slice* s = first_slice() ; s != NULL ; s = s->next_slice())
-        v_slices.push_back(s);
-
+      vector<const Slice*> v_slices(m_v_slices.begin(), m_v_slices.end());
       m_synthesis_tree = new TubeTreeSynthesis(this, 0, nb_slices() - 1, v_slices);
     }
     
@@ -1534,4 +1953,580 @@ namespace codac
         m_synthesis_tree = NULL;
       }
     }
+
+    // Slices structure
+
+    void Tube::rebuild_slices_index(Slice *first_slice)
+    {
+      m_v_slices.clear();
+      for(Slice *s = first_slice ; s != NULL ; s = s->next_slice())
+        m_v_slices.push_back(s);
+      update_slicing_uniformity();
+    }
+
+    Slice* Tube::allocate_slices(int n)
+    {
+      assert(n >= 0);
+      if(n == 0)
+        return NULL;
+
+      void *block = ::operator new(n * sizeof(Slice));
+      m_v_slabs.push_back(block);
+      return static_cast<Slice*>(block);
+    }
+
+    void Tube::destroy_slice(Slice *s)
+    {
+      if(s->m_in_slab)
+        s->~Slice(); // memory is released with the whole block
+      else
+        delete s;
+    }
+
+    void Tube::release_slices()
+    {
+      before_slicing_change();
+
+      for(Slice *s : m_v_slices)
+        destroy_slice(s);
+      m_v_slices.clear();
+
+      for(void *block : m_v_slabs)
+        ::operator delete(block);
+      m_v_slabs.clear();
+    }
+
+    const vector<int> Tube::batch_order(const vector<double>& v_t)
+    {
+      vector<int> v_order(v_t.size());
+      iota(v_order.begin(), v_order.end(), 0);
+
+      if(!is_sorted(v_t.begin(), v_t.end()))
+        stable_sort(v_order.begin(), v_order.end(),
+          [&v_t](int a, int b) { return v_t[a] < v_t[b]; });
+
+      return v_order;
+    }
+
+    const vector<int> Tube::batch_order(const vector<Interval>& v_t)
+    {
+      vector<int> v_order(v_t.size());
+      iota(v_order.begin(), v_order.end(), 0);
+
+      stable_sort(v_order.begin(), v_order.end(),
+        [&v_t](int a, int b)
+        {
+          if(v_t[a].is_empty()) return !v_t[b].is_empty();
+          if(v_t[b].is_empty()) return false;
+          return v_t[a].lb() < v_t[b].lb();
+        });
+
+      return v_order;
+    }
+
+    void Tube::eval_sorted_batch(const vector<double>& v_t, const vector<int>& v_order, vector<Interval>& v_y) const
+    {
+      assert(v_t.size() == v_order.size() && v_t.size() == v_y.size());
+      const Slice *s = first_slice();
+
+      for(int k : v_order)
+      {
+        double t = v_t[k];
+        assert(!isnan(t));
+
+        if(!tdomain().contains(t))
+          v_y[k] = Interval::all_reals();
+
+        else
+        {
+          // The slices are swept together with the sorted queries
+          while(t >= s->tdomain().ub() && s->next_slice() != NULL)
+            s = s->next_slice();
+          v_y[k] = (*s)(t);
+        }
+      }
+    }
+
+    void Tube::eval_sorted_batch(const vector<Interval>& v_t, const vector<int>& v_order, vector<Interval>& v_y) const
+    {
+      assert(v_t.size() == v_order.size() && v_t.size() == v_y.size());
+      const Slice *s = first_slice();
+
+      for(int k : v_order)
+      {
+        const Interval& t = v_t[k];
+
+        if(t.is_empty())
+          v_y[k] = Interval::empty_set();
+
+        else if(t.lb() < tdomain().lb() || t.ub() > tdomain().ub())
+          v_y[k] = Interval::all_reals();
+
+        else
+        {
+          // The slices are swept together with the sorted lower bounds
+          while(t.lb() >= s->tdomain().ub() && s->next_slice() != NULL)
+            s = s->next_slice();
+
+          if(t.is_degenerated())
+            v_y[k] = (*s)(t.lb());
+
+          else if(m_synthesis_tree != NULL) // fast evaluation
+            v_y[k] = m_synthesis_tree->operator()(t);
+
+          else
+          {
+            v_y[k] = Interval::EMPTY_SET;
+            for(const Slice *s_ = s ; s_ != NULL && s_->tdomain().lb() < t.ub() ; s_ = s_->next_slice())
+              v_y[k] |= s_->codomain();
+          }
+        }
+      }
+    }
+
+    int Tube::select_similar_slices(double distance_threshold, vector<bool>& v_removed_gates) const
+    {
+      v_removed_gates.assign(nb_slices(), false);
+      int nb_removals = 0;
+      Interval merged_codomain = first_slice()->codomain();
+
+      // Each slice is compared to the union of the previous ones it would be merged with
+      for(int k = 1 ; k < nb_slices() ; k++)
+      {
+        const Interval& y = slice(k)->codomain();
+        if(distance(merged_codomain, y) < distance_threshold)
+        {
+          v_removed_gates[k] = true;
+          merged_codomain |= y;
+          nb_removals++;
+        }
+
+        else
+          merged_codomain = y;
+      }
+
+      return nb_removals;
+    }
+
+    void Tube::remove_gates(const vector<bool>& v_removed_gates)
+    {
+      assert((int)v_removed_gates.size() == nb_slices());
+      assert(!v_removed_gates[0] && "cannot remove the initial gate");
+
+      before_slicing_change();
+      bool synthesis = m_synthesis_tree != NULL;
+      delete_synthesis_tree(); // rebuilt once at the end
+
+      vector<Slice*> v_slices;
+      v_slices.reserve(m_v_slices.size());
+
+      for(size_t k = 0 ; k < m_v_slices.size() ; k++)
+      {
+        if(v_removed_gates[k])
+        {
+          Slice::merge_slices(v_slices.back(), m_v_slices[k]);
+          destroy_slice(m_v_slices[k]);
+        }
+
+        else
+          v_slices.push_back(m_v_slices[k]);
+      }
+
+      m_v_slices.assign(std::move(v_slices));
+      update_slicing_uniformity();
+
+      if(synthesis)
+        create_synthesis_tree();
+    }
+
+    void Tube::create_slices(const vector<double>& v_gates_t)
+    {
+      assert(m_v_slices.empty());
+      assert(v_gates_t.size() >= 2 && "the tdomain bounds are required");
+
+      int n = v_gates_t.size() - 1;
+      Slice *block = allocate_slices(n);
+      m_v_slices.reserve(n);
+
+      Slice *prev_slice = NULL;
+      for(int k = 0 ; k < n ; k++)
+      {
+        Slice *slice = new(&block[k]) Slice(Interval(v_gates_t[k], v_gates_t[k+1]));
+        slice->m_in_slab = true;
+
+        if(prev_slice != NULL)
+        {
+          slice->m_input_gate = NULL;
+          Slice::chain_slices(prev_slice, slice);
+        }
+
+        prev_slice = slice;
+        m_v_slices.push_back(slice);
+      }
+
+      // Redundant information for fast access
+      m_tdomain = Interval(v_gates_t.front(), v_gates_t.back());
+      update_slicing_uniformity();
+    }
+
+    Slice* Tube::push_back_slice(double t_ub, const Interval& codomain, bool evict_first_slice)
+    {
+      assert(!m_v_slices.empty());
+      assert(t_ub > tdomain().ub());
+      assert(!evict_first_slice || nb_slices() > 1);
+
+      before_slicing_change();
+      delete_synthesis_tree(); // sliding tubes do not maintain trees
+
+      Slice *last = last_slice(), *new_slice = NULL;
+      Interval new_tdomain(tdomain().ub(), t_ub);
+      m_nb_nonuniform_slices -= is_nonuniform_slice(last); // was allowed to be smaller
+
+      if(evict_first_slice)
+      {
+        Slice *s = first_slice();
+        bool in_slab = s->m_in_slab;
+        m_nb_nonuniform_slices -= is_nonuniform_slice(s);
+        s->~Slice(); // the gate is handed over to the next slice
+        m_v_slices.pop_front();
+
+        // The memory of the evicted slice is reused
+        new_slice = new(s) Slice(new_tdomain, codomain);
+        new_slice->m_in_slab = in_slab;
+      }
+
+      else
+        new_slice = new Slice(new_tdomain, codomain);
+
+      new_slice->m_input_gate = NULL;
+      Slice::chain_slices(last, new_slice);
+      new_slice->set_input_gate(new_slice->input_gate());
+      m_v_slices.push_back(new_slice);
+
+      // Redundant information for fast access
+      m_tdomain = Interval(first_slice()->tdomain().lb(), t_ub);
+      m_nb_nonuniform_slices += is_nonuniform_slice(last) + is_nonuniform_slice(new_slice);
+
+      return new_slice;
+    }
+
+    void Tube::copy_slices(const Tube& x, Slice *first, const function<void(Slice*,int)>& f_values)
+    {
+      assert(m_v_slices.empty());
+
+      Slice *prev_slice = NULL;
+      m_v_slices.reserve(x.m_v_slices.size());
+
+      for(const Slice *s : x.m_v_slices)
+      {
+        Slice *slice = new(first) Slice(*s);
+        slice->m_in_slab = true;
+        m_v_slices.push_back(slice);
+
+        if(prev_slice != NULL)
+        {
+          slice->m_input_gate = NULL;
+          Slice::chain_slices(prev_slice, slice);
+        }
+
+        if(f_values)
+          f_values(slice, m_v_slices.size() - 1);
+
+        prev_slice = slice;
+        first++;
+      }
+
+      // Redundant information for fast access
+      m_tdomain = x.tdomain();
+      m_timestep = x.m_timestep;
+      m_nb_nonuniform_slices = x.m_nb_nonuniform_slices;
+
+      if(m_enable_synthesis && !m_v_slices.empty())
+        create_synthesis_tree();
+    }
+
+    int Tube::count_slices(const Interval& tdomain, double timestep)
+    {
+      if(timestep == 0.)
+        timestep = tdomain.diam();
+
+      // Same arithmetic as for the construction of the slices
+      int n = 0;
+      double ub = tdomain.lb();
+      do
+      {
+        ub = std::min(ub + timestep, tdomain.ub());
+        n++;
+      } while(ub < tdomain.ub());
+
+      return n;
+    }
+
+    void Tube::create_slices(const Interval& tdomain, double timestep, const Interval& codomain,
+      Slice *first, const function<void(Slice*,int)>& f_values)
+    {
+      assert(m_v_slices.empty());
+      assert(valid_tdomain(tdomain));
+
+      // Redundant information for fast access
+      m_tdomain = tdomain;
+
+      if(timestep == 0.)
+        timestep = tdomain.diam();
+      m_timestep = timestep;
+
+      int n = count_slices(tdomain, timestep);
+      m_v_slices.reserve(n);
+
+      Slice *prev_slice = NULL;
+      double lb, ub = tdomain.lb();
+
+      for(int k = 0 ; k < n ; k++)
+      {
+        lb = ub; // we guarantee all slices are adjacent
+        ub = std::min(lb + timestep, tdomain.ub()); // the tdomain of the last slice may be smaller
+
+        Slice *slice = new(first) Slice(Interval(lb,ub), codomain);
+        slice->m_in_slab = true;
+
+        if(prev_slice != NULL)
+        {
+          slice->m_input_gate = NULL;
+          Slice::chain_slices(prev_slice, slice);
+        }
+
+        m_v_slices.push_back(slice);
+
+        if(f_values)
+          f_values(slice, k);
+
+        prev_slice = slice;
+        first++;
+      }
+
+      if(m_enable_synthesis)
+        create_synthesis_tree();
+    }
+
+    const function<void(Slice*,int)> Tube::trajectories_sweep(const vector<const Trajectory*>& v_x)
+    {
+      // For each sampled trajectory, index of the first sample not before the current time
+      vector<size_t> v_i(v_x.size(), 0);
+
+      return [v_x,v_i](Slice *s, int k) mutable
+      {
+        const Interval t = s->tdomain();
+        Interval envelope = Interval::EMPTY_SET, input_gate = Interval::EMPTY_SET, output_gate = Interval::EMPTY_SET;
+
+        for(size_t j = 0 ; j < v_x.size() ; j++)
+        {
+          const Trajectory& x = *v_x[j];
+          assert(x.tdomain().is_superset(t));
+
+          if(x.definition_type() == TrajDefnType::ANALYTIC_FNC)
+          {
+            envelope |= x(t);
+            input_gate |= x(Interval(t.lb()));
+            output_gate |= x(Interval(t.ub()));
+            continue;
+          }
+
+          const vector<double>& v_t = x.sampled_times();
+          const vector<double>& v_y = x.sampled_values();
+          size_t& i = v_i[j];
+
+          // Value at t, with the same interpolation as Trajectory::operator()
+          auto value = [&](double t_) -> double
+          {
+            while(i < v_t.size() && v_t[i] < t_)
+              i++;
+            assert(i < v_t.size());
+
+            if(v_t[i] == t_)
+              return v_y[i];
+
+            return v_y[i-1] + (t_ - v_t[i-1]) * (v_y[i] - v_y[i-1]) / (v_t[i] - v_t[i-1]);
+          };
+
+          double y_lb = value(t.lb());
+          input_gate |= y_lb;
+          envelope |= y_lb;
+
+          for( ; i < v_t.size() && v_t[i] < t.ub() ; i++)
+            envelope |= v_y[i];
+
+          double y_ub = value(t.ub());
+          output_gate |= y_ub;
+          envelope |= y_ub;
+        }
+
+        s->set_envelope(envelope, false);
+        s->set_input_gate(input_gate, false);
+        if(t.ub() == v_x[0]->tdomain().ub()) // last slice
+          s->set_output_gate(output_gate, false);
+      };
+    }
+
+    void Tube::update_slicing_uniformity()
+    {
+      m_timestep = first_slice()->tdomain().diam();
+      m_nb_nonuniform_slices = 0;
+      for(const Slice *s : m_v_slices)
+        m_nb_nonuniform_slices += is_nonuniform_slice(s);
+    }
+
+    bool Tube::is_nonuniform_slice(const Slice *s) const
+    {
+      // Tolerance related to the floating-point computation of the gates
+      double w = s->tdomain().diam();
+      double eps = 1e-9 * m_timestep
+        + 8. * numeric_limits<double>::epsilon() * std::max(fabs(s->tdomain().lb()), fabs(s->tdomain().ub()));
+
+      if(s->next_slice() == NULL) // the last slice may be smaller
+        return w > m_timestep + eps;
+      return fabs(w - m_timestep) > eps;
+    }
+
+    // Snapshots
+
+    void Tube::register_snapshot(TubeSnapshot *snapshot) const
+    {
+      if(!m_track_slice_writes) // slices will notify writings from now on
+        track_slice_writes(true);
+      m_v_snapshots.push_back(snapshot);
+    }
+
+    void Tube::unregister_snapshot(TubeSnapshot *snapshot) const
+    {
+      m_v_snapshots.erase(remove(m_v_snapshots.begin(), m_v_snapshots.end(), snapshot), m_v_snapshots.end());
+      if(m_v_snapshots.empty() && m_invert_index.empty() && !m_aggregates.valid && m_v_chunk_epochs.empty())
+        track_slice_writes(false);
+    }
+
+    void Tube::before_slice_write(const Slice *s) const
+    {
+      m_invert_index.clear(); // lazily rebuilt by the next inversion
+
+      // The contribution of the slice is added again by after_slice_write()
+      if(m_aggregates.valid)
+        update_aggregates(s, -1);
+      m_aggregates.written_codomain = s->codomain();
+
+      if(!m_v_snapshots.empty() || !m_v_chunk_epochs.empty())
+      {
+        int i = index(s);
+        assert(i != -1 && "the slice must belong to this tube");
+        for(TubeSnapshot *snapshot : m_v_snapshots)
+          snapshot->copy_chunks_before_write(i);
+        if(!m_v_chunk_epochs.empty())
+          m_v_chunk_epochs[i / s_epoch_chunk_size] = ++s_write_epoch;
+      }
+    }
+
+    void Tube::after_slice_write(const Slice *s) const
+    {
+      Aggregates& a = m_aggregates;
+
+      if(a.valid)
+        update_aggregates(s, 1);
+
+      const Interval& y_prev = a.written_codomain;
+      const Interval y = s->codomain();
+
+      if(!a.valid_extrema || y == y_prev)
+        return;
+
+      // The extrema are computed again only if the slice was holding one of them
+      if(!y.is_superset(y_prev) && !y_prev.is_empty()
+        && (y_prev.lb() == a.codomain.lb() || y_prev.ub() == a.codomain.ub()
+          || (y_prev.is_unbounded() ? POS_INFINITY : y_prev.diam()) == a.max_diam))
+        a.valid_extrema = false;
+
+      else
+      {
+        a.codomain |= y;
+        a.max_diam = std::max(a.max_diam, y.is_unbounded() ? POS_INFINITY : y.diam());
+      }
+    }
+
+    void Tube::before_slicing_change() const
+    {
+      for(TubeSnapshot *snapshot : m_v_snapshots)
+        snapshot->detach();
+      m_v_snapshots.clear();
+      m_invert_index.clear();
+      m_aggregates.valid = false;
+      m_aggregates.valid_extrema = false;
+      m_v_chunk_epochs.clear(); // the whole tube is considered as modified
+
+      if(m_track_slice_writes)
+        track_slice_writes(false);
+    }
+
+    void Tube::update_references() const
+    {
+      if(m_synthesis_tree != NULL)
+        m_synthesis_tree->set_tube_reference(this);
+
+      for(TubeSnapshot *snapshot : m_v_snapshots)
+        snapshot->m_tube_ref = this;
+
+      if(m_track_slice_writes)
+        for(Slice *s : m_v_slices)
+          s->m_tube_ref = this;
+    }
+
+    void Tube::track_slice_writes(bool enable) const
+    {
+      for(Slice *s : m_v_slices)
+        s->m_tube_ref = enable ? this : NULL;
+      m_track_slice_writes = enable;
+    }
+
+    // Inversion index
+
+    void Tube::build_invert_index() const
+    {
+      int n = nb_slices(), size = 1;
+      while(size < n)
+        size *= 2;
+
+      m_invert_index.assign(2 * size, Interval::EMPTY_SET);
+      for(int k = 0 ; k < n ; k++)
+      {
+        const Interval y = m_v_slices[k]->codomain();
+        m_invert_index[size + k] = y.is_empty() ? Interval::ALL_REALS : y; // empty slices are handled by Slice::invert
+      }
+
+      for(int node = size - 1 ; node > 0 ; node--)
+        m_invert_index[node] = m_invert_index[2*node] | m_invert_index[2*node+1];
+
+      if(!m_track_slice_writes) // the index is dropped by the next writing
+        track_slice_writes(true);
+    }
+
+    int Tube::search_invert_index(const Interval& y, int i0, int i1, bool leftmost, int node, int node_lb, int node_ub) const
+    {
+      if(node_ub < 0)
+        node_ub = m_invert_index.size() / 2 - 1;
+
+      if(node_ub < i0 || node_lb > i1 || !m_invert_index[node].intersects(y))
+        return -1;
+
+      if(node_lb == node_ub)
+        return node_lb;
+
+      int mid = (node_lb + node_ub) / 2, k;
+      if(leftmost)
+      {
+        k = search_invert_index(y, i0, i1, true, 2*node, node_lb, mid);
+        return k != -1 ? k : search_invert_index(y, i0, i1, true, 2*node+1, mid+1, node_ub);
+      }
+
+      else
+      {
+        k = search_invert_index(y, i0, i1, false, 2*node+1, mid+1, node_ub);
+        return k != -1 ? k : search_invert_index(y, i0, i1, false, 2*node, node_lb, mid);
+      }
+    }
 }
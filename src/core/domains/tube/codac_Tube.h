@@ -13,10 +13,14 @@
 #define __CODAC_TUBE_H__
 
 #include <map>
+#include <atomic>
 #include <list>
 #include <vector>
+#include <functional>
 #include "codac_TFnc.h"
 #include "codac_Slice.h"
+#include "codac_IntervalArray.h"
+#include "codac_SliceIndex.h"
 #include "codac_Trajectory.h"
 #include "codac_serialize_tubes.h"
 #include "codac_tube_arithmetic.h"
@@ -34,6 +38,7 @@ namespace codac
   class Slice;
   class Trajectory;
   class TubeTreeSynthesis;
+  class TubeSnapshot;
 
   /**
    * \class Tube
@@ -91,6 +96,31 @@ namespace codac
        */
       explicit Tube(const std::vector<Interval>& v_tdomains, const std::vector<Interval>& v_codomains);
 
+      /**
+       * \brief Creates a tube \f$[x](\cdot)\f$ from a sorted list of gate times
+       *        \f$(t_0,t_1,\dots,t_f)\f$, in one shot
+       *
+       * \note The slicing is built in \f$\mathcal{O}(n)\f$, without successive samplings.
+       *
+       * \param v_gates_t sorted vector of the times of the gates, including the bounds of the tdomain
+       * \param codomain Interval value of the slices (all reals \f$[-\infty,\infty]\f$ by default)
+       */
+      explicit Tube(const std::vector<double>& v_gates_t, const Interval& codomain = Interval::ALL_REALS);
+
+      /**
+       * \brief Creates a tube \f$[x](\cdot)\f$ from a sorted list of gate times
+       *        \f$(t_0,t_1,\dots,t_f)\f$ and the values of the related slices, in one shot
+       *
+       * \note The slicing is built in \f$\mathcal{O}(n)\f$, without successive samplings.
+       * \note Without specified values, the gates are the intersections of the adjacent codomains.
+       *
+       * \param v_gates_t sorted vector of the \f$n+1\f$ times of the gates, including the bounds of the tdomain
+       * \param v_codomains vector of the \f$n\f$ codomains of the slices
+       * \param v_gates optional vector of the \f$n+1\f$ values of the gates
+       */
+      explicit Tube(const std::vector<double>& v_gates_t, const std::vector<Interval>& v_codomains,
+        const std::vector<Interval>& v_gates = std::vector<Interval>());
+
       /**
        * \brief Creates a copy of a scalar tube \f$[x](\cdot)\f$, with the same time discretization
        *
@@ -98,6 +128,17 @@ namespace codac
        */
       Tube(const Tube& x);
 
+      /**
+       * \brief Creates a scalar tube by moving the slices of \f$[x](\cdot)\f$, without copy
+       *
+       * \note x is left without slices: it can then only be destroyed or assigned
+       * \note Nothing is allocated: the synthesis tree and the snapshots of x
+       *       follow its slices
+       *
+       * \param x Tube to be moved
+       */
+      Tube(Tube&& x) noexcept;
+
       /**
        * \brief Creates a copy of a scalar tube \f$[x](\cdot)\f$, with the same time
        *        discretization but a specific codomain defined by a TFnc object
@@ -113,6 +154,43 @@ namespace codac
        */
       explicit Tube(const Tube& x, const TFnc& f, int f_image_id = 0);
 
+      /**
+       * \brief Creates a scalar tube with the same time discretization as \f$[x](\cdot)\f$,
+       *        whose values (envelopes and gates) are the images of the values of \f$[x](\cdot)\f$
+       *
+       * \note The images are computed while the slices are copied, in a single pass.
+       *       This is the kernel of the arithmetic operators on tubes.
+       *
+       * \param x Tube from which the sampling and the values are taken
+       * \param f interval function applied on each value of x
+       */
+      explicit Tube(const Tube& x, const std::function<Interval(const Interval&)>& f);
+
+      /**
+       * \brief Creates a scalar tube with the same time discretization as \f$[x_1](\cdot)\f$ and
+       *        \f$[x_2](\cdot)\f$, whose values are the images of their values by a binary function
+       *
+       * \note The images are computed while the slices are copied, in a single pass.
+       *       This is the kernel of the arithmetic operators on tubes.
+       *
+       * \param x1 first Tube operand
+       * \param x2 second Tube operand, of same slicing
+       * \param f interval function applied on each pair of values of x1 and x2
+       */
+      explicit Tube(const Tube& x1, const Tube& x2, const std::function<Interval(const Interval&,const Interval&)>& f);
+
+      /**
+       * \brief Creates a scalar tube with the same time discretization as \f$[x](\cdot)\f$,
+       *        and the given values
+       *
+       * \note The values are set while the slices are copied, in a single pass.
+       *       This is the kernel of the vectorized arithmetic operators on tubes.
+       *
+       * \param x Tube from which the sampling is taken
+       * \param v the \f$2n+1\f$ values of the gates and envelopes, in the order of values()
+       */
+      explicit Tube(const Tube& x, const IntervalArray& v);
+
       /**
        * \brief Creates a scalar tube \f$[x](\cdot)\f$ enclosing a trajectory \f$x(\cdot)\f$,
        *        possibly with some temporal discretization
@@ -178,7 +256,7 @@ namespace codac
        * \param c the constant of integration (0. by default)
        * \return a new Tube object with same slicing, enclosing the feasible primitives of this tube
        */
-      const Tube primitive(const Interval& c = Interval(0.)) const;
+      Tube primitive(const Interval& c = Interval(0.)) const;
 
       /**
        * \brief Returns a copy of a Tube
@@ -188,6 +266,19 @@ namespace codac
        */
       const Tube& operator=(const Tube& x);
 
+      /**
+       * \brief Moves the slices of a Tube into this one, without copy
+       *
+       * \note The contents of the two tubes are exchanged: x receives the former
+       *       slices of this tube, released with it. Nothing is allocated: the
+       *       synthesis tree (and its enabling) and the snapshots of x follow its slices.
+       * \note The whole tube is then considered as modified by modified_slices()
+       *
+       * \param x the Tube object to be moved
+       * \return this tube, with the former slicing and values of x
+       */
+      const Tube& operator=(Tube&& x) noexcept;
+
       /**
        * \brief Returns the temporal definition domain of this tube
        *
@@ -357,6 +448,33 @@ namespace codac
        */
       int index(const Slice* slice) const;
 
+      /**
+       * \brief Returns the current writing epoch, and records from now on
+       *        the slices that are modified
+       *
+       * \note Epochs are shared by all the tubes: an epoch obtained from a tube
+       *       can be compared to the writings of any other tube.
+       *
+       * \return an epoch to be provided later to modified_slices()
+       */
+      unsigned long write_epoch() const;
+
+      /**
+       * \brief Returns the range of slices modified since an epoch
+       *
+       * \note Writings are recorded by chunks of consecutive slices, so the range
+       *       may be larger than the actual modifications. A writing on a gate is
+       *       recorded on the slice it was done through, not on its neighbor.
+       * \note The whole tube is considered as modified after a change of slicing,
+       *       or if write_epoch() has not been called since then.
+       *
+       * \param epoch an epoch previously returned by write_epoch()
+       * \param first_slice_id index of the first slice possibly modified
+       * \param last_slice_id index of the last slice possibly modified
+       * \return false if no slice has been modified since the epoch
+       */
+      bool modified_slices(unsigned long epoch, int& first_slice_id, int& last_slice_id) const;
+
       /**
        * \brief Samples this tube at \f$t\f$
        *
@@ -402,6 +520,17 @@ namespace codac
        */
       void sample(const Tube& x);
 
+      /**
+       * \brief Samples this tube at each time of a sorted list, in a single pass
+       *
+       * \note Times at which a gate already exists are without effect.
+       * \note The complexity is linear in the number of slices and times,
+       *       the optional synthesis tree being rebuilt once.
+       *
+       * \param v_t sorted vector of temporal keys (that must belong to the Tube's tdomain)
+       */
+      void sample(const std::vector<double>& v_t);
+
       /**
        * \brief Tests if a gate exists at time \f$t\f$
        *
@@ -426,6 +555,25 @@ namespace codac
        */
       void merge_similar_slices(double distance_threshold);
 
+      /**
+       * \brief Adapts the slicing of this tube within a budget of slices
+       *
+       * Adjacent slices closer than the threshold are merged, as with merge_similar_slices().
+       * While the budget is exceeded, the gates between the most similar slices are removed.
+       * Otherwise, the slices around which the diameter of the codomain varies the most are
+       * bisected, until the budget is reached.
+       *
+       * \note The complexity is linear in the number of slices (in average).
+       *
+       * \note Bisected slices keep the codomain of their parent: no information is gained
+       *       until the tube is contracted afterwards (for instance with CtcDeriv),
+       *       the new slices being then contracted separately.
+       *
+       * \param max_nb_slices maximal number of slices of the tube
+       * \param distance_threshold the threshold for the maximum Haussdorf distance between adjacent slices to be merged (0 by default)
+       */
+      void adapt_slicing(int max_nb_slices, double distance_threshold = 0.);
+
       /// @}
       /// \name Accessing values
       /// @{
@@ -437,6 +585,17 @@ namespace codac
        */
       const Interval codomain() const;
 
+      /**
+       * \brief Returns the values of the gates and envelopes of this tube, in temporal order
+       *
+       * \note For \f$n\f$ slices, the \f$2n+1\f$ values are the input gate of the
+       *       first slice, its envelope, its output gate, the envelope of the second
+       *       slice, and so on. This contiguous storage is the one of the interval kernels.
+       *
+       * \return the IntervalArray of the values
+       */
+      IntervalArray values() const;
+
       /**
        * \brief Returns the volume of this tube
        *
@@ -471,6 +630,28 @@ namespace codac
        */
       const Interval operator()(const Interval& t) const;
 
+      /**
+       * \brief Returns the evaluations of this tube at several times, as with operator()(double)
+       *
+       * \note The queries are sorted once and swept together with the slices:
+       *       the cost is in \f$\mathcal{O}(n+q\log q)\f$ for \f$q\f$ queries and \f$n\f$ slices
+       *
+       * \param v_t the vector of temporal keys
+       * \return the vector of the Interval values \f$[x](t_i)\f$, in the order of the queries
+       */
+      const std::vector<Interval> eval_batch(const std::vector<double>& v_t) const;
+
+      /**
+       * \brief Returns the evaluations of this tube over several subtdomains,
+       *        as with operator()(const Interval&)
+       *
+       * \note The queries are sorted once and swept together with the slices
+       *
+       * \param v_t the vector of subtdomains
+       * \return the vector of the Interval envelopes \f$[x]([t_i])\f$, in the order of the queries
+       */
+      const std::vector<Interval> eval_batch(const std::vector<Interval>& v_t) const;
+
       /**
        * \brief Returns the interval evaluations of the bounds of the
        *        tube \f$\underline{x^-}(\cdot)\f$ and \f$\overline{x^+}(\cdot)\f$ over \f$[t]\f$
@@ -508,6 +689,8 @@ namespace codac
        * \brief Returns the interval inversion \f$[x]^{-1}([y])\f$
        *
        * \note If the inversion results in several pre-images, their union is returned
+       * \note Without synthesis tree, an index of the codomains of the slices is built
+       *       at the first inversion, for fast inversions of several values
        *
        * \param y the interval codomain
        * \param search_tdomain the optional temporal domain on which the inversion will be performed
@@ -518,6 +701,9 @@ namespace codac
       /**
        * \brief Computes the set of continuous values of the inversion \f$[x]^{-1}([y])\f$
        *
+       * \note An index of the codomains of the slices is built at the first inversion,
+       *       for fast inversions of several values
+       *
        * \param y the interval codomain
        * \param v_t the vector of the sub-tdomains \f$[t_k]\f$ for which
        *            \f$\forall t\in[t_k] \mid x(t)\in[y], x(\cdot)\in[x](\cdot)\f$
@@ -566,6 +752,16 @@ namespace codac
        */
       double max_gate_diam(double& t) const;
 
+      /**
+       * \brief Returns the sum of the diameters of the gates of this tube
+       *
+       * \note As for volume(), codomain() and max_diam(), the value is cached
+       *       until the next writing on the slices
+       *
+       * \return the sum of the thicknesses of the gates, POS_INFINITY if one is unbounded
+       */
+      double sum_gates_diam() const;
+
       /**
        * \brief Returns the diameters of the tube as a trajectory
        *
@@ -743,6 +939,17 @@ namespace codac
        */
       const Tube& set(const Interval& y, int slice_id);
 
+      /**
+       * \brief Sets the values of the gates and envelopes of this tube
+       *
+       * \note The sampling of this tube is preserved. No consistency is enforced
+       *       between the envelopes and the gates.
+       *
+       * \param v the \f$2n+1\f$ values, in the order of values()
+       * \return *this
+       */
+      const Tube& set_values(const IntervalArray& v);
+
       /**
        * \brief Sets the interval value of this tube at \f$t\f$: \f$[x](t)=[y]\f$
        *
@@ -981,6 +1188,28 @@ namespace codac
        */
       const Tube& operator&=(const Tube& x);
 
+      /**
+       * \brief Applies a unary function in place on the envelopes and gates of the tube
+       *
+       * \note No tube is created: the slices of this tube are reused.
+       *
+       * \param f the interval function, for instance \f$\sin\f$
+       * \return (*this)=f(*this)
+       */
+      const Tube& apply(const std::function<Interval(const Interval&)>& f);
+
+      /**
+       * \brief Sets this tube to \f$f([x](\cdot))\f$, reusing its slices
+       *
+       * \note Both tubes must share the same slicing. This avoids the allocation
+       *       of a new tube when a derived tube is computed again.
+       *
+       * \param x the Tube operand, possibly this tube itself
+       * \param f the interval function
+       * \return (*this)=f(x)
+       */
+      const Tube& apply(const Tube& x, const std::function<Interval(const Interval&)>& f);
+
       /// @}
       /// \name String
       /// @{
@@ -1156,6 +1385,53 @@ namespace codac
        */
       const IntervalVector codomain_box() const;
 
+      /**
+       * \brief Aggregated values of the slices of the tube
+       */
+      struct Aggregates
+      {
+        bool valid = false; //!< true if the sums are up to date with the slices
+        bool valid_extrema = false; //!< true if codomain and max_diam are up to date with the slices
+        double volume = 0.; //!< sum of the volumes of the slices
+        double sum_gates_diam = 0.; //!< sum of the diameters of the gates
+        double max_diam = 0.; //!< diameter of the largest slice
+        Interval codomain = Interval::EMPTY_SET; //!< hull of the codomains of the slices
+
+        // Incremental updates of the sums, with unbounded terms counted apart
+        double bounded_volume = 0.; //!< sum of the finite volumes of the slices
+        double bounded_gates_diam = 0.; //!< sum of the finite diameters of the gates
+        int nb_unbounded_volumes = 0; //!< number of slices of infinite volume
+        int nb_unbounded_gates = 0; //!< number of unbounded gates
+        double max_bounded_volume = 0.; //!< largest value of bounded_volume since the last full computation
+        double max_bounded_gates_diam = 0.; //!< largest value of bounded_gates_diam since the last full computation
+        int nb_updates = 0; //!< number of incremental updates since the last full computation
+        Interval written_codomain = Interval::EMPTY_SET; //!< codomain of the slice being written, before the writing
+      };
+
+      /**
+       * \brief Returns the aggregated values of the slices, computed in one pass if needed
+       *
+       * \note Once computed, the sums (volume, diameters of the gates) are updated
+       *       in constant time by the writings on the slices. The hull of the codomains
+       *       and the largest diameter are computed again only when a written slice
+       *       was holding one of their bounds. Any change of slicing drops the values.
+       *
+       * \return a const reference to the Aggregates of this tube
+       */
+      const Aggregates& aggregates() const;
+
+      /**
+       * \brief Adds (or removes) the contribution of a slice to the sums of the aggregates
+       *
+       * \note Sums obtained after large cancellations, or after a number of updates
+       *       equal to the number of slices, are dropped and computed again by the
+       *       next request, so that rounding errors do not accumulate
+       *
+       * \param s a const pointer to a Slice object of this tube
+       * \param sign 1 to add the contribution of s, -1 to remove it
+       */
+      void update_aggregates(const Slice *s, int sign) const;
+
       /**
        * \brief Restores a scalar tube from serialization, together with a Trajectory object
        *
@@ -1179,19 +1455,293 @@ namespace codac
        */
       void delete_synthesis_tree() const;
 
+      /**
+       * \brief Rebuilds the contiguous index of slices from the linked list
+       *
+       * \note To be called after any change in the slicing structure
+       *       that is not locally reflected in the index
+       *
+       * \param first_slice a pointer to the first Slice object of this tube
+       */
+      void rebuild_slices_index(Slice *first_slice);
+
+      /**
+       * \brief Allocates a memory block for the construction of n contiguous slices
+       *
+       * \note The block is owned by the tube and freed by release_slices(),
+       *       slices have to be constructed in it with placement new
+       *
+       * \param n number of slices
+       * \return a pointer to uninitialized memory for n Slice objects
+       */
+      Slice* allocate_slices(int n);
+
+      /**
+       * \brief Destroys a Slice object of this tube, whether it has been
+       *        constructed in a memory block of the tube or individually
+       *
+       * \param s a pointer to the Slice object to be destroyed
+       */
+      static void destroy_slice(Slice *s);
+
+      /**
+       * \brief Destroys all the slices of this tube and frees their memory
+       */
+      void release_slices();
+
+      /**
+       * \brief Returns the indices of batch queries sorted by increasing times
+       *
+       * \param v_t the vector of temporal keys
+       * \return the vector of the sorted indices of the queries
+       */
+      static const std::vector<int> batch_order(const std::vector<double>& v_t);
+
+      /**
+       * \brief Returns the indices of batch queries sorted by increasing lower bounds
+       *
+       * \note Empty subtdomains come first
+       *
+       * \param v_t the vector of subtdomains
+       * \return the vector of the sorted indices of the queries
+       */
+      static const std::vector<int> batch_order(const std::vector<Interval>& v_t);
+
+      /**
+       * \brief Evaluates this tube at several times, by sweeping the slices in the given order
+       *
+       * \param v_t the vector of temporal keys
+       * \param v_order the indices of the queries, sorted by increasing times
+       * \param v_y the vector of results, already sized
+       */
+      void eval_sorted_batch(const std::vector<double>& v_t, const std::vector<int>& v_order, std::vector<Interval>& v_y) const;
+
+      /**
+       * \brief Evaluates this tube over several subtdomains, by sweeping the slices in the given order
+       *
+       * \param v_t the vector of subtdomains
+       * \param v_order the indices of the queries, sorted by increasing lower bounds
+       * \param v_y the vector of results, already sized
+       */
+      void eval_sorted_batch(const std::vector<Interval>& v_t, const std::vector<int>& v_order, std::vector<Interval>& v_y) const;
+
+      /**
+       * \brief Selects the adjacent slices whose Hausdorff distance is less than
+       *        the given threshold, as merged by merge_similar_slices()
+       *
+       * \param distance_threshold the threshold for the maximum Haussdorf distance between adjacent slices
+       * \param v_removed_gates flags of the input gates to be removed, for each slice
+       * \return the number of gates to be removed
+       */
+      int select_similar_slices(double distance_threshold, std::vector<bool>& v_removed_gates) const;
+
+      /**
+       * \brief Removes a set of gates and merges the related slices, in a single pass
+       *
+       * \param v_removed_gates flags of the input gates to be removed, for each slice
+       *                        (the initial gate cannot be removed)
+       */
+      void remove_gates(const std::vector<bool>& v_removed_gates);
+
+      /**
+       * \brief Builds the adjacent slices of this tube, with \f$[-\infty,\infty]\f$ values,
+       *        in a single memory block
+       *
+       * \param v_gates_t sorted vector of the times of the gates, including the bounds of the tdomain
+       */
+      void create_slices(const std::vector<double>& v_gates_t);
+
+      /**
+       * \brief Appends a slice at the end of this tube, possibly in place of
+       *        the first slice that is then removed
+       *
+       * \note When the first slice is evicted, its memory is reused for the new slice:
+       *       the memory usage of a sliding tube remains constant
+       *
+       * \param t_ub upper bound of the tdomain of the new slice
+       * \param codomain Interval value of the new slice
+       * \param evict_first_slice if true, the first slice of the tube is removed
+       * \return a pointer to the new last slice
+       */
+      Slice* push_back_slice(double t_ub, const Interval& codomain, bool evict_first_slice);
+
+      /**
+       * \brief Builds the slices of this tube as copies of the slices of x,
+       *        in a memory block already owned by this tube
+       *
+       * \param x the Tube object to be copied
+       * \param first location of the first slice in the block
+       * \param f_values optional function called on each new slice, with its index,
+       *        once chained to the previous one (for computing its values in the same pass)
+       */
+      void copy_slices(const Tube& x, Slice *first,
+        const std::function<void(Slice*,int)>& f_values = std::function<void(Slice*,int)>());
+
+      /**
+       * \brief Counts the slices of a tube built from a temporal domain and a timestep
+       *
+       * \param tdomain temporal domain \f$[t_0,t_f]\f$
+       * \param timestep width of the slices (0 for one slice only)
+       * \return the number of slices
+       */
+      static int count_slices(const Interval& tdomain, double timestep);
+
+      /**
+       * \brief Builds the slices of this tube from a temporal domain and a timestep,
+       *        in a memory block already owned by this tube
+       *
+       * \param tdomain temporal domain \f$[t_0,t_f]\f$
+       * \param timestep width of the slices (0 for one slice only)
+       * \param codomain initial value of the slices
+       * \param first location of the first slice in the block, of count_slices() locations
+       * \param f_values optional function called on each new slice, with its index,
+       *        once chained to the previous one (for computing its values in the same pass)
+       */
+      void create_slices(const Interval& tdomain, double timestep, const Interval& codomain,
+        Slice *first,
+        const std::function<void(Slice*,int)>& f_values = std::function<void(Slice*,int)>());
+
+      /**
+       * \brief Returns a function setting the values of slices to the hull
+       *        of some trajectories, for create_slices() or copy_slices()
+       *
+       * \note The slices have to be visited in chronological order: the values
+       *        of sampled trajectories are then obtained in a single sweep
+       *        over their samples, with no search
+       *
+       * \param v_x pointers to the trajectories, defined over the tdomain of the slices
+       * \return the function computing the envelope and the gates of a slice
+       */
+      static const std::function<void(Slice*,int)> trajectories_sweep(const std::vector<const Trajectory*>& v_x);
+
+      /**
+       * \brief Computes the reference width of the slices (the width
+       *        of the first one) and counts the slices that differ from it
+       *
+       * \note A uniform slicing allows direct time-to-index conversions
+       */
+      void update_slicing_uniformity();
+
+      /**
+       * \brief Tests whether the width of a slice of this tube differs from
+       *        the reference width of the slicing
+       *
+       * \note The last slice is allowed to be smaller
+       *
+       * \param s a const pointer to a Slice object of this tube
+       * \return true in case of a non-uniform slice
+       */
+      bool is_nonuniform_slice(const Slice *s) const;
+
+      /**
+       * \brief Registers a snapshot sharing the values of this tube
+       *
+       * \note The slices then notify the tube before any writing of their values
+       *
+       * \param snapshot a pointer to the TubeSnapshot object
+       */
+      void register_snapshot(TubeSnapshot *snapshot) const;
+
+      /**
+       * \brief Unregisters a snapshot of this tube
+       *
+       * \param snapshot a pointer to the TubeSnapshot object
+       */
+      void unregister_snapshot(TubeSnapshot *snapshot) const;
+
+      /**
+       * \brief Copies the values of a slice (and of its neighborhood) into the
+       *        snapshots that still share them, before the slice is written
+       *
+       * \note The inversion index is dropped, the contribution of the slice is removed
+       *       from the cached aggregates, and the writing is recorded if write_epoch()
+       *       has been called
+       *
+       * \param s a const pointer to a Slice object of this tube
+       */
+      void before_slice_write(const Slice *s) const;
+
+      /**
+       * \brief Updates the cached aggregates after a writing on a slice
+       *
+       * \param s a const pointer to the written Slice object of this tube
+       */
+      void after_slice_write(const Slice *s) const;
+
+      /**
+       * \brief Makes the snapshots of this tube entirely independent from it,
+       *        and drops the inversion index, the cached aggregates and the recorded
+       *        writings, before a change of its slicing or its destruction
+       */
+      void before_slicing_change() const;
+
+      /**
+       * \brief Makes the synthesis tree, the snapshots and the tracked slices
+       *        refer to this tube, once its slices have been moved from another one
+       *
+       * \note No allocation: called by the move assignment, that is noexcept
+       */
+      void update_references() const;
+
+      /**
+       * \brief Enables or disables the notifications of the slices before their writings
+       *
+       * \param enable if true, the slices will call before_slice_write() before any writing
+       */
+      void track_slice_writes(bool enable) const;
+
+      /**
+       * \brief Builds the inversion index: a segment tree of the hulls of the codomains
+       *        of the slices, stored in a flat array
+       *
+       * \note The index is dropped by any writing on the slices, and lazily rebuilt
+       */
+      void build_invert_index() const;
+
+      /**
+       * \brief Returns the first (or last) slice of a range whose codomain may intersect \f$[y]\f$,
+       *        according to the inversion index
+       *
+       * \note Empty slices are always returned, their inversion is computed by the Slice class
+       *
+       * \param y the interval codomain
+       * \param i0 index of the first slice of the range
+       * \param i1 index of the last slice of the range
+       * \param leftmost if true, the first candidate is returned, otherwise the last one
+       * \param node current node of the index (root by default)
+       * \param node_lb index of the first slice covered by the node
+       * \param node_ub index of the last slice covered by the node (computed from the root if negative)
+       * \return the index of the slice, or -1 if none
+       */
+      int search_invert_index(const Interval& y, int i0, int i1, bool leftmost, int node = 1, int node_lb = 0, int node_ub = -1) const;
+
       // Class variables:
 
-        Slice *m_first_slice = NULL; //!< pointer to the first Slice object of this tube
+        SliceIndex m_v_slices; //!< pointers to the Slice objects of this tube, in temporal order
+        std::vector<void*> m_v_slabs; //!< memory blocks in which slices are constructed in a row
+        double m_timestep = 0.; //!< reference width of the slices
+        int m_nb_nonuniform_slices = 0; //!< number of slices not matching m_timestep (0 for a uniform slicing)
         mutable TubeTreeSynthesis *m_synthesis_tree = NULL; //!< pointer to the optional synthesis tree
         mutable bool m_enable_synthesis = Tube::s_enable_syntheses; //!< enables of the use of a synthesis tree
         Interval m_tdomain; //!< redundant information for fast evaluations
+        mutable std::vector<TubeSnapshot*> m_v_snapshots; //!< snapshots sharing the values of this tube
+        mutable std::vector<Interval> m_invert_index; //!< flat segment tree of the codomains, for fast inversions (empty if not built)
+        mutable bool m_track_slice_writes = false; //!< true if the slices notify this tube before any writing
+        mutable Aggregates m_aggregates; //!< cached values of volume(), codomain(), max_diam() and sum_gates_diam()
+        mutable std::vector<unsigned long> m_v_chunk_epochs; //!< epochs of the last writings on chunks of slices (empty if not recorded)
 
       friend void deserialize_Tube(std::ifstream& bin_file, Tube *&tube);
       friend void deserialize_TubeVector(std::ifstream& bin_file, TubeVector *&tube);
       friend class TubeVector;
       friend class CtcEval;
+      friend class Slice;
+      friend class TubeSnapshot;
+      friend class SlidingTubeVector;
+      friend class TubeExpr;
 
       static bool s_enable_syntheses;
+      static std::atomic<unsigned long> s_write_epoch; //!< last epoch, common to all the tubes (possibly written by several threads)
+      static const int s_epoch_chunk_size; //!< number of slices per chunk of recorded writings
   };
 }
 
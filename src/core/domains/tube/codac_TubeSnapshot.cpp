@@ -0,0 +1,205 @@
+/**
+ *  TubeSnapshot class
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <algorithm>
+#include "codac_TubeSnapshot.h"
+#include "codac_Tube.h"
+#include "codac_Slice.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace codac
+{
+  const int TubeSnapshot::s_chunk_size = 128;
+
+  // Public methods
+
+    // Definition
+
+    TubeSnapshot::TubeSnapshot(const Tube& x)
+      : m_tube_ref(&x), m_tdomain(x.tdomain()), m_nb_slices(x.nb_slices())
+    {
+      assert(m_nb_slices > 0);
+      m_v_chunks.resize((m_nb_slices + s_chunk_size - 1) / s_chunk_size, NULL);
+      x.register_snapshot(this);
+    }
+
+    TubeSnapshot::~TubeSnapshot()
+    {
+      if(m_tube_ref != NULL)
+        m_tube_ref->unregister_snapshot(this);
+      clear_chunks();
+    }
+
+    const Interval TubeSnapshot::tdomain() const
+    {
+      return m_tdomain;
+    }
+
+    int TubeSnapshot::nb_slices() const
+    {
+      return m_nb_slices;
+    }
+
+    // Accessing values
+
+    const Interval TubeSnapshot::slice_tdomain(int slice_id) const
+    {
+      assert(slice_id >= 0 && slice_id < nb_slices());
+      int c = slice_id / s_chunk_size;
+
+      if(m_v_chunks[c] == NULL)
+        return m_tube_ref->slice(slice_id)->tdomain();
+
+      int i = slice_id - c * s_chunk_size;
+      return Interval(m_v_chunks[c]->v_t[i], m_v_chunks[c]->v_t[i+1]);
+    }
+
+    const Interval TubeSnapshot::operator()(int slice_id) const
+    {
+      assert(slice_id >= 0 && slice_id < nb_slices());
+      int c = slice_id / s_chunk_size;
+
+      if(m_v_chunks[c] == NULL)
+        return m_tube_ref->slice(slice_id)->codomain();
+
+      return m_v_chunks[c]->v_codomains[slice_id - c * s_chunk_size];
+    }
+
+    const Interval TubeSnapshot::gate(int gate_id) const
+    {
+      assert(gate_id >= 0 && gate_id <= nb_slices());
+      int c = std::min(gate_id / s_chunk_size, (int)m_v_chunks.size() - 1);
+
+      if(m_v_chunks[c] == NULL)
+      {
+        if(gate_id == nb_slices())
+          return m_tube_ref->last_slice()->output_gate();
+        return m_tube_ref->slice(gate_id)->input_gate();
+      }
+
+      return m_v_chunks[c]->v_gates[gate_id - c * s_chunk_size];
+    }
+
+    double TubeSnapshot::volume() const
+    {
+      double volume = 0.;
+      for(int k = 0 ; k < nb_slices() ; k++)
+      {
+        double slice_volume = slice_tdomain(k).diam() * (*this)(k).diam();
+        if(slice_volume == POS_INFINITY)
+          return POS_INFINITY;
+        volume += slice_volume;
+      }
+      return volume;
+    }
+
+    int TubeSnapshot::nb_copied_chunks() const
+    {
+      return count_if(m_v_chunks.begin(), m_v_chunks.end(), [](const Chunk *c) { return c != NULL; });
+    }
+
+    // Restoring values
+
+    void TubeSnapshot::restore(Tube& x)
+    {
+      assert(x.nb_slices() == nb_slices());
+      assert(x.tdomain() == tdomain());
+
+      bool own_tube = (&x == m_tube_ref);
+
+      // The snapshot is not notified of its own writings
+      if(own_tube)
+        x.unregister_snapshot(this);
+
+      for(size_t c = 0 ; c < m_v_chunks.size() ; c++)
+      {
+        if(own_tube && m_v_chunks[c] == NULL)
+          continue; // unchanged chunk
+
+        int k0 = c * s_chunk_size, kf = std::min(k0 + s_chunk_size, nb_slices());
+        for(int k = k0 ; k < kf ; k++)
+        {
+          Slice *s = x.slice(k);
+          assert(s->tdomain() == slice_tdomain(k) && "the tubes must have the same slicing");
+          s->set_envelope((*this)(k), false);
+          s->set_input_gate(gate(k), false);
+        }
+
+        if(kf == nb_slices())
+          x.last_slice()->set_output_gate(gate(kf), false);
+      }
+
+      if(own_tube)
+      {
+        clear_chunks(); // values are shared again
+        x.register_snapshot(this);
+      }
+    }
+
+  // Protected methods
+
+    void TubeSnapshot::copy_chunk(int chunk_id)
+    {
+      assert(chunk_id >= 0 && chunk_id < (int)m_v_chunks.size());
+      assert(m_tube_ref != NULL);
+
+      if(m_v_chunks[chunk_id] != NULL)
+        return; // already copied
+
+      int k0 = chunk_id * s_chunk_size, kf = std::min(k0 + s_chunk_size, nb_slices());
+      Chunk *chunk = new Chunk;
+      chunk->v_t.reserve(kf - k0 + 1);
+      chunk->v_codomains.reserve(kf - k0);
+      chunk->v_gates.reserve(kf - k0 + 1);
+
+      const Slice *s = NULL;
+      for(int k = k0 ; k < kf ; k++)
+      {
+        s = m_tube_ref->slice(k);
+        chunk->v_t.push_back(s->tdomain().lb());
+        chunk->v_codomains.push_back(s->codomain());
+        chunk->v_gates.push_back(s->input_gate());
+      }
+
+      chunk->v_t.push_back(s->tdomain().ub());
+      chunk->v_gates.push_back(s->output_gate());
+      m_v_chunks[chunk_id] = chunk;
+    }
+
+    void TubeSnapshot::copy_chunks_before_write(int slice_id)
+    {
+      int c = slice_id / s_chunk_size;
+      copy_chunk(c);
+
+      // Gates at the boundaries of a chunk are shared with the neighbor chunk
+      if(slice_id % s_chunk_size == 0 && c > 0)
+        copy_chunk(c - 1);
+      if((slice_id + 1) % s_chunk_size == 0 && c + 1 < (int)m_v_chunks.size())
+        copy_chunk(c + 1);
+    }
+
+    void TubeSnapshot::detach()
+    {
+      for(size_t c = 0 ; c < m_v_chunks.size() ; c++)
+        copy_chunk(c);
+      m_tube_ref = NULL;
+    }
+
+    void TubeSnapshot::clear_chunks()
+    {
+      for(Chunk *&c : m_v_chunks)
+      {
+        delete c;
+        c = NULL;
+      }
+    }
+}
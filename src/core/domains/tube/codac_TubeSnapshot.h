@@ -0,0 +1,166 @@
+/**
+ *  \file
+ *  TubeSnapshot class
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_TUBESNAPSHOT_H__
+#define __CODAC_TUBESNAPSHOT_H__
+
+#include <vector>
+#include "codac_Interval.h"
+
+namespace codac
+{
+  class Tube;
+
+  /**
+   * \class TubeSnapshot
+   * \brief Read-only copy of the values of a Tube, sharing them with the tube
+   *        until they are modified (copy-on-write)
+   *
+   * The slices are grouped into chunks of consecutive slices. Before a slice
+   * of the tube is written, the chunk containing it is copied into the snapshots
+   * that still share it: only modified chunks are duplicated.
+   *
+   * \note Structural changes of the tube (sampling, merging, truncation, shift,
+   *       destruction, assignment) make the snapshot entirely independent.
+   */
+  class TubeSnapshot
+  {
+    public:
+
+      /**
+       * \brief Creates a snapshot of the current values of a tube, without copy
+       *
+       * \param x the Tube object whose values are shared
+       */
+      explicit TubeSnapshot(const Tube& x);
+
+      /**
+       * \brief TubeSnapshot destructor
+       */
+      ~TubeSnapshot();
+
+      TubeSnapshot(const TubeSnapshot&) = delete;
+      TubeSnapshot& operator=(const TubeSnapshot&) = delete;
+
+      /**
+       * \brief Returns the temporal domain of the snapshot
+       *
+       * \return an Interval object \f$[t_0,t_f]\f$
+       */
+      const Interval tdomain() const;
+
+      /**
+       * \brief Returns the number of slices of the snapshot
+       *
+       * \return an integer
+       */
+      int nb_slices() const;
+
+      /**
+       * \brief Returns the temporal domain of the ith slice
+       *
+       * \param slice_id the index of the slice
+       * \return an Interval object \f$[t^k_0,t^k_f]\f$
+       */
+      const Interval slice_tdomain(int slice_id) const;
+
+      /**
+       * \brief Returns the value of the ith slice, as it was when the snapshot was taken
+       *
+       * \param slice_id the index of the slice
+       * \return Interval envelope of the slice
+       */
+      const Interval operator()(int slice_id) const;
+
+      /**
+       * \brief Returns the value of the ith gate, as it was when the snapshot was taken
+       *
+       * \param gate_id the index of the gate, between 0 and nb_slices()
+       * \return Interval value of the gate
+       */
+      const Interval gate(int gate_id) const;
+
+      /**
+       * \brief Returns the volume of the snapshot, as computed by Tube::volume()
+       *
+       * \return volume of the related tube when the snapshot was taken
+       */
+      double volume() const;
+
+      /**
+       * \brief Returns the number of chunks that have been duplicated so far
+       *
+       * \return an integer between 0 and the number of chunks
+       */
+      int nb_copied_chunks() const;
+
+      /**
+       * \brief Restores the values of the snapshot in a tube of same slicing
+       *
+       * \note If x is the tube of the snapshot, only the modified chunks are
+       *       written back and the snapshot shares again all the values of x
+       *
+       * \param x the Tube object to be restored
+       */
+      void restore(Tube& x);
+
+      static const int s_chunk_size; //!< number of slices per chunk
+
+    protected:
+
+      /**
+       * \brief Values of a chunk of consecutive slices, copied from the tube
+       */
+      struct Chunk
+      {
+        std::vector<double> v_t; //!< bounds of the tdomains of the slices
+        std::vector<Interval> v_codomains; //!< envelopes of the slices
+        std::vector<Interval> v_gates; //!< gates of the slices, including the last output gate
+      };
+
+      /**
+       * \brief Copies a chunk from the tube, if it is still shared
+       *
+       * \param chunk_id the index of the chunk
+       */
+      void copy_chunk(int chunk_id);
+
+      /**
+       * \brief Copies the chunks that may be impacted by a write on a slice
+       *        of the tube (the slice's one, and a neighbor one for boundary gates)
+       *
+       * \param slice_id the index of the slice that is about to be written
+       */
+      void copy_chunks_before_write(int slice_id);
+
+      /**
+       * \brief Copies all the remaining shared chunks, so that the snapshot
+       *        no longer depends on its tube
+       */
+      void detach();
+
+      /**
+       * \brief Deletes the copied chunks
+       */
+      void clear_chunks();
+
+      // Class variables:
+
+        const Tube *m_tube_ref = NULL; //!< tube sharing its values, NULL once detached
+        Interval m_tdomain; //!< temporal domain of the snapshot
+        int m_nb_slices = 0; //!< number of slices of the snapshot
+        std::vector<Chunk*> m_v_chunks; //!< copied chunks (NULL if still shared with the tube)
+
+      friend class Tube;
+  };
+}
+
+#endif
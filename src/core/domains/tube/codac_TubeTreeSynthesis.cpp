@@ -232,7 +232,7 @@ namespace codac
 
     else
     {
-      int mid_id = ceil(nb_slices() / 2.);
+      int mid_id = m_first_subtree->nb_slices();
 
       if(slice_id < mid_id)
         return m_first_subtree->slice(slice_id);
@@ -297,6 +297,141 @@ namespace codac
     }
   }
 
+  TubeTreeSynthesis* TubeTreeSynthesis::sample(const Slice *new_slice)
+  {
+    assert(is_leaf());
+    assert(new_slice != NULL && m_slice_ref->next_slice() == new_slice);
+
+    // The leaf becomes a node made of two leaves:
+    // the sampled slice and the new one
+    vector<const Slice*> v_slices({ m_slice_ref, new_slice });
+
+    m_first_subtree = new TubeTreeSynthesis(m_tube_ref, 0, 0, v_slices);
+    m_first_subtree->m_parent = this;
+    m_second_subtree = new TubeTreeSynthesis(m_tube_ref, 1, 1, v_slices);
+    m_second_subtree->m_parent = this;
+    m_slice_ref = NULL;
+
+    request_structure_update();
+    return rebalance();
+  }
+
+  TubeTreeSynthesis* TubeTreeSynthesis::remove_leaf()
+  {
+    assert(is_leaf());
+    assert(!is_root() && "cannot remove the last leaf of the tree");
+
+    // The parent node is replaced by the sibling of this leaf
+
+    TubeTreeSynthesis *parent = m_parent;
+    TubeTreeSynthesis *sibling = parent->m_first_subtree == this
+      ? parent->m_second_subtree : parent->m_first_subtree;
+    TubeTreeSynthesis *grandparent = parent->m_parent;
+
+    sibling->m_parent = grandparent;
+    if(grandparent != NULL)
+    {
+      if(grandparent->m_first_subtree == parent)
+        grandparent->m_first_subtree = sibling;
+      else
+        grandparent->m_second_subtree = sibling;
+    }
+
+    parent->m_first_subtree = NULL;
+    parent->m_second_subtree = NULL;
+    delete parent;
+    delete this; // the reference from the slice is removed
+
+    if(grandparent == NULL)
+      return sibling; // new root
+
+    grandparent->request_structure_update();
+    return grandparent->rebalance();
+  }
+
+  void TubeTreeSynthesis::request_structure_update()
+  {
+    // Updating the nodes from this one up to the root
+    for(TubeTreeSynthesis *node = this ; node != NULL ; node = node->m_parent)
+    {
+      if(node->is_leaf())
+      {
+        node->m_tdomain = node->m_slice_ref->tdomain();
+        node->m_nb_slices = 1;
+      }
+
+      else
+      {
+        node->m_tdomain = node->m_first_subtree->tdomain() | node->m_second_subtree->tdomain();
+        node->m_nb_slices = node->m_first_subtree->nb_slices() + node->m_second_subtree->nb_slices();
+      }
+
+      node->m_values_update_needed = true;
+      node->m_integrals_update_needed = true;
+    }
+  }
+
+  void TubeTreeSynthesis::set_tube_reference(const Tube *tube)
+  {
+    // Called when the slices of the tube are moved to another Tube object
+    m_tube_ref = tube;
+    if(!is_leaf())
+    {
+      m_first_subtree->set_tube_reference(tube);
+      m_second_subtree->set_tube_reference(tube);
+    }
+  }
+
+  TubeTreeSynthesis* TubeTreeSynthesis::rebalance()
+  {
+    // Weight-balanced tree: the highest node on the path to the root
+    // for which a subtree is too heavy is rebuilt from its slices
+    // (amortized logarithmic complexity)
+
+    TubeTreeSynthesis *unbalanced = NULL;
+    for(TubeTreeSynthesis *node = this ; node != NULL ; node = node->m_parent)
+      if(!node->is_leaf()
+        && std::max(node->m_first_subtree->nb_slices(), node->m_second_subtree->nb_slices()) > 0.7 * node->nb_slices())
+        unbalanced = node;
+
+    if(unbalanced == NULL)
+      return root();
+
+    const Tube *tube = m_tube_ref;
+    TubeTreeSynthesis *parent = unbalanced->m_parent;
+    bool first_subtree = parent != NULL && parent->m_first_subtree == unbalanced;
+
+    vector<const Slice*> v_slices;
+    unbalanced->get_slices(v_slices);
+
+    delete unbalanced; // may include this node
+    TubeTreeSynthesis *subtree = new TubeTreeSynthesis(tube, 0, v_slices.size() - 1, v_slices);
+    subtree->m_parent = parent;
+
+    if(parent == NULL)
+      return subtree; // new root
+
+    if(first_subtree)
+      parent->m_first_subtree = subtree;
+    else
+      parent->m_second_subtree = subtree;
+    return parent->root();
+  }
+
+  void TubeTreeSynthesis::get_slices(vector<const Slice*>& v_slices) const
+  {
+    // The leaves are considered instead of the linked list of slices,
+    // that may be under modification
+    if(is_leaf())
+      v_slices.push_back(m_slice_ref);
+
+    else
+    {
+      m_first_subtree->get_slices(v_slices);
+      m_second_subtree->get_slices(v_slices);
+    }
+  }
+
   bool TubeTreeSynthesis::is_leaf() const
   {
     bool is_leaf_ = (m_first_subtree == NULL && m_second_subtree == NULL);
@@ -351,7 +486,7 @@ namespace codac
 
   void TubeTreeSynthesis::update_integrals()
   {
-    if(m_values_update_needed)
+    if(m_integrals_update_needed)
     {
       // 1. Updating leafs values (leaf nodes)
 
@@ -47,8 +47,18 @@ namespace codac
       std::pair<Interval,Interval> partial_integral(const Interval& t);
       const std::pair<Interval,Interval> partial_primitive_bounds(const Interval& t = Interval::ALL_REALS);
 
+      // Incremental updates of the structure (methods called on leaves,
+      // returning the possibly new root of the tree)
+      TubeTreeSynthesis* sample(const Slice *new_slice);
+      TubeTreeSynthesis* remove_leaf();
+      void request_structure_update();
+      void set_tube_reference(const Tube *tube);
+
     protected:
 
+      TubeTreeSynthesis* rebalance();
+      void get_slices(std::vector<const Slice*>& v_slices) const;
+
       // Slices connections
       const Slice *m_slice_ref = NULL;
       const Tube *m_tube_ref = NULL;
@@ -8,6 +8,8 @@
  *              the GNU Lesser General Public License (LGPL).
  */
 
+#include <utility>
+#include <thread>
 #include "codac_TubeVector.h"
 #include "codac_Exception.h"
 #include "codac_CtcDeriv.h"
@@ -117,6 +119,11 @@ namespace codac
       *this = x;
     }
 
+    TubeVector::TubeVector(TubeVector&& x) noexcept
+    {
+      *this = std::move(x);
+    }
+
     TubeVector::TubeVector(const TubeVector& x, const IntervalVector& codomain)
       : TubeVector(x)
     {
@@ -133,22 +140,19 @@ namespace codac
     }
 
     TubeVector::TubeVector(const TrajectoryVector& traj, double timestep)
-      : TubeVector(traj.tdomain(), timestep, traj.size())
     {
       assert(traj.same_tdomain_forall_components());
       assert(timestep >= 0.);
-      set_empty();
-      *this |= traj;
+      create_components({ &traj }, timestep);
     }
 
     TubeVector::TubeVector(const TrajectoryVector& lb, const TrajectoryVector& ub, double timestep)
-      : TubeVector(lb, timestep)
     {
       assert(timestep >= 0.);
       assert(lb.same_tdomain_forall_components() && ub.same_tdomain_forall_components());
       assert(lb.tdomain() == ub.tdomain());
       assert(lb.size() == ub.size());
-      *this |= ub;
+      create_components({ &lb, &ub }, timestep);
     }
 
     TubeVector::TubeVector(const string& binary_file_name)
@@ -186,6 +190,9 @@ namespace codac
 
     const TubeVector& TubeVector::operator=(const TubeVector& x)
     {
+      if(this == &x)
+        return *this;
+
       { // Destroying already existing components
         if(m_v_tubes != NULL)
           delete[] m_v_tubes;
@@ -200,6 +207,22 @@ namespace codac
       return *this;
     }
 
+    const TubeVector& TubeVector::operator=(TubeVector&& x) noexcept
+    {
+      if(this == &x)
+        return *this;
+
+      delete[] m_v_tubes;
+
+      m_n = x.m_n;
+      m_v_tubes = x.m_v_tubes;
+
+      x.m_n = 0;
+      x.m_v_tubes = NULL;
+
+      return *this;
+    }
+
     const Interval TubeVector::tdomain() const
     {
       Interval t = (*this)[0].tdomain();
@@ -224,11 +247,11 @@ namespace codac
 
       int i = 0;
       for(; i < size() && i < n ; i++)
-        new_vec[i] = m_v_tubes[i];
+        new_vec[i] = std::move(m_v_tubes[i]);
 
       for(; i < n ; i++)
       {
-        new_vec[i] = Tube(m_v_tubes[0]); // same slicing is used
+        new_vec[i] = Tube(new_vec[0]); // same slicing is used
         new_vec[i].set(Interval::ALL_REALS);
       }
 
@@ -323,6 +346,12 @@ namespace codac
         (*this)[i].sample(x[i]);
     }
 
+    void TubeVector::sample(const vector<double>& v_t)
+    {
+      for(int i = 0 ; i < size() ; i++)
+        (*this)[i].sample(v_t);
+    }
+
     // Accessing values
 
     const IntervalVector TubeVector::codomain() const
@@ -377,6 +406,38 @@ namespace codac
       return box;
     }
 
+    const vector<IntervalVector> TubeVector::eval_batch(const vector<double>& v_t) const
+    {
+      const vector<int> v_order = Tube::batch_order(v_t);
+      vector<IntervalVector> v_y(v_t.size(), IntervalVector(size()));
+      vector<Interval> v_yi(v_t.size());
+
+      for(int i = 0 ; i < size() ; i++)
+      {
+        (*this)[i].eval_sorted_batch(v_t, v_order, v_yi);
+        for(size_t k = 0 ; k < v_t.size() ; k++)
+          v_y[k][i] = v_yi[k];
+      }
+
+      return v_y;
+    }
+
+    const vector<IntervalVector> TubeVector::eval_batch(const vector<Interval>& v_t) const
+    {
+      const vector<int> v_order = Tube::batch_order(v_t);
+      vector<IntervalVector> v_y(v_t.size(), IntervalVector(size()));
+      vector<Interval> v_yi(v_t.size());
+
+      for(int i = 0 ; i < size() ; i++)
+      {
+        (*this)[i].eval_sorted_batch(v_t, v_order, v_yi);
+        for(size_t k = 0 ; k < v_t.size() ; k++)
+          v_y[k][i] = v_yi[k];
+      }
+
+      return v_y;
+    }
+
     const pair<IntervalVector,IntervalVector> TubeVector::eval(const Interval& t) const
     {
       assert(tdomain().is_superset(t));
@@ -622,12 +683,15 @@ namespace codac
       Trajectory diag_traj;
       TrajectoryVector diams = diam(gates_thicknesses);
 
-      for(map<double,double>::const_iterator it = diams[0].sampled_map().begin() ; it != diams[0].sampled_map().end() ; it++)
+      const vector<double>& v_t = diams[0].sampled_times();
+      const vector<double>& v_d = diams[0].sampled_values();
+
+      for(size_t k = 0 ; k < v_t.size() ; k++)
       {
         double diag = 0.;
         for(int i = start_index ; i <= end_index ; i++)
-          diag += std::pow(it->second, 2);
-        diag_traj.set(std::sqrt(diag), it->first);
+          diag += std::pow(v_d[k], 2);
+        diag_traj.set(std::sqrt(diag), v_t[k]);
       }
 
       return diag_traj;
@@ -999,8 +1063,79 @@ namespace codac
       return hull;
     }
 
+    int TubeVector::s_nb_threads = std::max(1, (int)thread::hardware_concurrency());
+    const int TubeVector::s_parallel_creation_min_slices = 10000;
+
+    void TubeVector::set_nb_threads(int nb_threads)
+    {
+      assert(nb_threads >= 0);
+      if(nb_threads == 0)
+        nb_threads = std::max(1, (int)thread::hardware_concurrency());
+      s_nb_threads = nb_threads;
+    }
+
+    int TubeVector::nb_threads()
+    {
+      return s_nb_threads;
+    }
+
   // Protected methods
 
+    // Definition
+
+    void TubeVector::create_components(const vector<const TrajectoryVector*>& v_x, double timestep)
+    {
+      assert(!v_x.empty());
+
+      const Interval tdomain = v_x[0]->tdomain();
+      int n = v_x[0]->size();
+      int nb_slices = Tube::count_slices(tdomain, timestep);
+      Tube *v_tubes = new Tube[n];
+
+      // Memory blocks are allocated before the threads are started
+      vector<Slice*> v_blocks(n);
+      for(int i = 0 ; i < n ; i++)
+        v_blocks[i] = v_tubes[i].allocate_slices(nb_slices);
+
+      auto create = [&](int i)
+      {
+        vector<const Trajectory*> v_xi;
+        for(const TrajectoryVector *x : v_x)
+          v_xi.push_back(&(*x)[i]);
+        v_tubes[i].create_slices(tdomain, timestep, Interval::ALL_REALS, v_blocks[i], Tube::trajectories_sweep(v_xi));
+      };
+
+      // The components are independent. Analytic trajectories are not
+      // evaluated in parallel, their functions not being thread safe.
+      int nb_threads = 1;
+      if((long)n * nb_slices >= s_parallel_creation_min_slices)
+      {
+        nb_threads = std::min(n, s_nb_threads);
+        for(const TrajectoryVector *x : v_x)
+          for(int i = 0 ; i < n ; i++)
+            if((*x)[i].definition_type() == TrajDefnType::ANALYTIC_FNC)
+              nb_threads = 1;
+      }
+
+      vector<thread> v_threads;
+      for(int k = 1 ; k < nb_threads ; k++)
+        v_threads.push_back(thread([&create,k,n,nb_threads]()
+        {
+          for(int i = k ; i < n ; i += nb_threads)
+            create(i);
+        }));
+
+      for(int i = 0 ; i < n ; i += nb_threads) // the calling thread builds the first components
+        create(i);
+
+      for(thread& th : v_threads)
+        th.join();
+
+      delete[] m_v_tubes;
+      m_n = n;
+      m_v_tubes = v_tubes;
+    }
+
     // Access values
 
     const IntervalVector TubeVector::codomain_box() const
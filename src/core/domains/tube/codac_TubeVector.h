@@ -117,6 +117,15 @@ namespace codac
        */
       TubeVector(const TubeVector& x);
 
+      /**
+       * \brief Creates a n-dimensional tube by moving the components of \f$[\mathbf{x}](\cdot)\f$, without copy
+       *
+       * \note x is left without components: it can then only be destroyed or assigned
+       *
+       * \param x TubeVector to be moved
+       */
+      TubeVector(TubeVector&& x) noexcept;
+
       /**
        * \brief Creates a copy of a n-dimensional tube \f$[\mathbf{x}](\cdot)\f$, with the same time
        *        discretization but a specific constant codomain
@@ -143,6 +152,8 @@ namespace codac
        * \note Due to the slicing implementation of the tube, a wrapping
        *       effect will occur to reliably enclose the TrajectoryVector object 
        *
+       * \note For large tubes, the components are built in parallel
+       *
        * \param traj TrajectoryVector \f$\mathbf{x}(\cdot)\f$ to enclose
        * \param timestep sampling value \f$\delta\f$ for the temporal discretization
        */
@@ -155,6 +166,8 @@ namespace codac
        * \note Due to the slicing implementation of the tube, a wrapping
        *       effect will occur to reliably enclose the TrajectoryVector object 
        *
+       * \note For large tubes, the components are built in parallel
+       *
        * \param lb TrajectoryVector defining the lower bound \f$\mathbf{x}^{-}(\cdot)\f$ of the tube
        * \param ub TrajectoryVector defining the upper bound \f$\mathbf{x}^{+}(\cdot)\f$ of the tube
        * \param timestep sampling value \f$\delta\f$ for the temporal discretization
@@ -243,6 +256,16 @@ namespace codac
        */
       const TubeVector& operator=(const TubeVector& x);
 
+      /**
+       * \brief Moves the components of a TubeVector into this one, without copy
+       *
+       * \note x is left without components: it can then only be destroyed or assigned
+       *
+       * \param x the TubeVector object to be moved
+       * \return this tube, with the former components of x
+       */
+      const TubeVector& operator=(TubeVector&& x) noexcept;
+
       /**
        * \brief Returns the temporal definition domain of this tube
        *
@@ -330,6 +353,16 @@ namespace codac
        */
       void sample(const TubeVector& x);
 
+      /**
+       * \brief Samples each component of this tube at each time of a sorted list,
+       *        in a single pass
+       *
+       * \note Times at which a gate already exists are without effect.
+       *
+       * \param v_t sorted vector of temporal keys (that must belong to the TubeVector's tdomain)
+       */
+      void sample(const std::vector<double>& v_t);
+
       /// @}
       /// \name Accessing values
       /// @{
@@ -391,6 +424,26 @@ namespace codac
        */
       const IntervalVector operator()(const Interval& t) const;
 
+      /**
+       * \brief Returns the evaluations of this tube at several times
+       *
+       * \note The queries are sorted once for all the components
+       *
+       * \param v_t the vector of temporal keys (that must belong to the TubeVector's tdomain)
+       * \return the vector of the IntervalVector values \f$[\mathbf{x}](t_i)\f$, in the order of the queries
+       */
+      const std::vector<IntervalVector> eval_batch(const std::vector<double>& v_t) const;
+
+      /**
+       * \brief Returns the evaluations of this tube over several subtdomains
+       *
+       * \note The queries are sorted once for all the components
+       *
+       * \param v_t the vector of subtdomains (that must be subsets of the TubeVector's tdomain)
+       * \return the vector of the IntervalVector envelopes \f$[\mathbf{x}]([t_i])\f$, in the order of the queries
+       */
+      const std::vector<IntervalVector> eval_batch(const std::vector<Interval>& v_t) const;
+
       /**
        * \brief Returns the interval evaluations of the bounds of the
        *        tube \f$\underline{\mathbf{x}^-}(\cdot)\f$ and \f$\overline{\mathbf{x}^+}(\cdot)\f$ over \f$[t]\f$
@@ -991,6 +1044,23 @@ namespace codac
        */
       const TubeVector& operator&=(const TubeVector& x);
 
+      /**
+       * \brief Applies a unary function in place on each component of the tube
+       *
+       * \param f the interval function, for instance \f$\sin\f$
+       * \return (*this)=f(*this)
+       */
+      const TubeVector& apply(const std::function<Interval(const Interval&)>& f);
+
+      /**
+       * \brief Sets each component of this tube to \f$f([x_i](\cdot))\f$, reusing its slices
+       *
+       * \param x the TubeVector operand, of same size and slicing
+       * \param f the interval function
+       * \return (*this)=f(x)
+       */
+      const TubeVector& apply(const TubeVector& x, const std::function<Interval(const Interval&)>& f);
+
       /// @}
       /// \name String
       /// @{
@@ -1152,6 +1222,23 @@ namespace codac
        */
       static const TubeVector hull(const std::list<TubeVector>& l_tubes);
 
+      /**
+       * \brief Sets the number of threads building the components of large tubes
+       *        from sampled trajectories (constructors from TrajectoryVector objects)
+       *
+       * \note Results do not depend on the number of threads.
+       *
+       * \param nb_threads number of threads (0 for the number of cores, by default)
+       */
+      static void set_nb_threads(int nb_threads);
+
+      /**
+       * \brief Returns the number of threads building the components of large tubes
+       *
+       * \return the number of threads
+       */
+      static int nb_threads();
+
     protected:
 
       /**
@@ -1181,11 +1268,28 @@ namespace codac
        */
       void deserialize(const std::string& binary_file_name, TrajectoryVector *&traj);
 
+      /**
+       * \brief Replaces the components of this tube by the hulls of trajectories,
+       *        with a common slicing
+       *
+       * \note The values of each component are computed in a single sweep over
+       *       the samples of the trajectories (see Tube::trajectories_sweep()).
+       *       Components defined by sampled trajectories are built in parallel
+       *       (see set_nb_threads()) when the tube is large enough.
+       *
+       * \param v_x pointers to the n-dimensional trajectories, of same tdomain
+       * \param timestep sampling value \f$\delta\f$ for the temporal discretization
+       */
+      void create_components(const std::vector<const TrajectoryVector*>& v_x, double timestep);
+
       // Class variables:
 
         int m_n = 0; //!< dimension of this tube
         Tube *m_v_tubes = NULL; //!< array of components (scalar tubes)
 
+      static int s_nb_threads; //!< number of threads building the components (see set_nb_threads())
+      static const int s_parallel_creation_min_slices; //!< minimal number of slices (over all the components) for a parallel construction
+
       friend void deserialize_TubeVector(std::ifstream& bin_file, TubeVector *&tube);
   };
 }
@@ -86,4 +86,20 @@ namespace codac
   macro_assign_vect_scal(operator/=);
   macro_assign_vect_vect(operator|=);
   macro_assign_vect_vect(operator&=);
+
+  const TubeVector& TubeVector::apply(const function<Interval(const Interval&)>& f)
+  {
+    for(int i = 0 ; i < size() ; i++)
+      (*this)[i].apply(f);
+    return *this;
+  }
+
+  const TubeVector& TubeVector::apply(const TubeVector& x, const function<Interval(const Interval&)>& f)
+  {
+    assert(size() == x.size());
+
+    for(int i = 0 ; i < size() ; i++)
+      (*this)[i].apply(x[i], f);
+    return *this;
+  }
 }
\ No newline at end of file
@@ -115,4 +115,27 @@ namespace codac
   macro_assign_scal(operator/=);
   macro_assign_scal(operator&=);
   macro_assign_scal(operator|=);
+
+  const Tube& Tube::apply(const function<Interval(const Interval&)>& f)
+  {
+    return apply(*this, f);
+  }
+
+  const Tube& Tube::apply(const Tube& x, const function<Interval(const Interval&)>& f)
+  {
+    assert(Tube::same_slicing(*this, x));
+
+    // Each value of x is read before the same value of this tube is written,
+    // so that x can be this tube
+    const Slice *s_x = x.first_slice();
+    for(Slice *s = first_slice() ; s != NULL ; s = s->next_slice())
+    {
+      s->set_envelope(f(s_x->codomain()), false);
+      s->set_input_gate(f(s_x->input_gate()), false);
+      s_x = s_x->next_slice();
+    }
+
+    last_slice()->set_output_gate(f(x.last_slice()->output_gate()), false);
+    return *this;
+  }
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
  */
 
 #include <sstream>
+#include <thread>
 #include "codac_TFunction.h"
 #include "codac_Tube.h"
 #include "codac_TubeVector.h"
@@ -148,6 +149,8 @@ namespace codac
       delete m_ibex_f;
     m_ibex_f = new Function(*f.m_ibex_f);
     m_expr = f.m_expr;
+    m_nb_threads = f.m_nb_threads;
+    m_tape = f.m_tape;
     TFnc::operator=(f);
     return *this;
   }
@@ -161,6 +164,7 @@ namespace codac
     delete fi.m_ibex_f;
     fi.m_ibex_f = new Function(ibex_fi);
     fi.m_img_dim = 1;
+    fi.m_tape.reset(); // compiled for the whole function
     return fi;
   }
   
@@ -260,14 +264,14 @@ namespace codac
   {
     assert(nb_var() == 0);
     IntervalVector box(1, t);
-    return m_ibex_f->eval_vector(box);
+    return eval_box(box);
   }
 
   const IntervalVector TFunction::eval_vector(const IntervalVector& x) const
   {
     assert(nb_var() == x.size() - 1);
     assert(!is_intertemporal());
-    return m_ibex_f->eval_vector(x);
+    return eval_box(x);
   }
 
   const IntervalVector TFunction::eval_vector(int slice_id, const TubeVector& x) const
@@ -288,7 +292,7 @@ namespace codac
     box[0] = t;
     box.put(1, x(slice_id));
 
-    return m_ibex_f->eval_vector(box);
+    return eval_box(box);
   }
 
   const IntervalVector TFunction::eval_vector(const Interval& t, const TubeVector& x) const
@@ -308,7 +312,49 @@ namespace codac
       for(int i = 0 ; i < x.size() ; i++)
         box[i+1] = x[i](t);
 
-    return m_ibex_f->eval_vector(box);
+    return eval_box(box);
+  }
+
+  const vector<IntervalVector> TFunction::eval_vector(const vector<IntervalVector>& v_x) const
+  {
+    assert(!is_intertemporal());
+
+    int n = v_x.size();
+    int nb_threads = std::max(1, std::min(m_nb_threads, n));
+    vector<IntervalVector> v_y(n, IntervalVector(image_dim()));
+
+    // Each thread evaluates a contiguous range of boxes with its own copy
+    // of the IBEX function, whose evaluation is not thread-safe.
+    // A compiled tape is shared, each thread evaluating its range as a batch.
+    auto eval_range = [&](const Function *f, int k0, int kf)
+    {
+      if(m_tape)
+        m_tape->eval_vector(v_x, v_y, k0, kf);
+
+      else
+        for(int k = k0 ; k < kf ; k++)
+        {
+          assert(v_x[k].size() == nb_var() + 1);
+          v_y[k] = f->eval_vector(v_x[k]);
+        }
+    };
+
+    vector<Function*> v_f;
+    vector<thread> v_threads;
+    for(int j = 1 ; j < nb_threads ; j++)
+    {
+      v_f.push_back(m_tape ? NULL : new Function(*m_ibex_f));
+      v_threads.push_back(thread(eval_range, v_f.back(), j * n / nb_threads, (j + 1) * n / nb_threads));
+    }
+
+    eval_range(m_ibex_f, 0, n / nb_threads); // first range computed by the calling thread
+
+    for(thread& th : v_threads)
+      th.join();
+    for(Function *f : v_f)
+      delete f;
+
+    return v_y;
   }
 
   const TubeVector TFunction::eval_vector(const TubeVector& x) const
@@ -332,6 +378,12 @@ namespace codac
       return y;
     }
 
+    if((m_nb_threads > 1 || m_tape) && x.nb_slices() > 1)
+    {
+      eval_slices_batch(x, y); // slices evaluated as a batch (by the tape, if compiled) shared among the threads
+      return y;
+    }
+
     IntervalVector box(x.size() + 1), result(y.size());
 
     const Slice **v_sx = new const Slice*[x.size()];
@@ -363,14 +415,14 @@ namespace codac
       box[0] = v_sx[0]->tdomain();
       for(int i = 0 ; i < x.size() ; i++)
         box[i+1] = v_sx[i]->codomain();
-      result = m_ibex_f->eval_vector(box);
+      result = eval_box(box);
       for(int i = 0 ; i < y.size() ; i++)
         v_sy[i]->set_envelope(result[i], false);
 
       box[0] = box[0].lb();
       for(int i = 0 ; i < x.size() ; i++)
         box[i+1] = v_sx[i]->input_gate();
-      result = m_ibex_f->eval_vector(box);
+      result = eval_box(box);
       for(int i = 0 ; i < y.size() ; i++)
         v_sy[i]->set_input_gate(result[i], false);
 
@@ -379,7 +431,7 @@ namespace codac
     box[0] = v_sx[0]->tdomain().ub();
     for(int i = 0 ; i < x.size() ; i++)
       box[i+1] = v_sx[i]->output_gate();
-    result = m_ibex_f->eval_vector(box);
+    result = eval_box(box);
     for(int i = 0 ; i < y.size() ; i++)
       v_sy[i]->set_output_gate(result[i], false);
 
@@ -404,14 +456,13 @@ namespace codac
       && "eval TFunction not supported for analytic trajectories");
     
     TrajectoryVector y(image_dim());
-    for(map<double,double>::const_iterator it = x[0].sampled_map().begin() ;
-        it != x[0].sampled_map().end() ; it++)
+    for(double t : x[0].sampled_times())
     {
       Vector v(nb_var() + 1);
-      v[0] = it->first;
-      v.put(1, x(it->first));
+      v[0] = t;
+      v.put(1, x(t));
 
-      y.set(m_ibex_f->eval_vector(v).mid(), it->first);
+      y.set(m_ibex_f->eval_vector(v).mid(), t);
     }
 
     return y;
@@ -422,6 +473,88 @@ namespace codac
     TFunction diff_f = *this;
     delete diff_f.m_ibex_f;
     diff_f.m_ibex_f = new Function(m_ibex_f->diff());
+    diff_f.m_tape.reset();
     return diff_f;
   }
+
+  const IntervalMatrix TFunction::jacobian(const IntervalVector& x) const
+  {
+    assert(nb_var() == x.size() - 1);
+    return m_tape ? m_tape->jacobian(x) : m_ibex_f->jacobian(x);
+  }
+
+  void TFunction::compile()
+  {
+    vector<string> v_args(1, "t");
+    for(int i = 0 ; i < nb_var() ; i++)
+      v_args.push_back(arg_name(i));
+
+    m_tape = make_shared<const TFunctionTape>(v_args, m_expr);
+    assert(m_tape->image_dim() == image_dim());
+  }
+
+  bool TFunction::is_compiled() const
+  {
+    return m_tape != NULL;
+  }
+
+  void TFunction::set_nb_threads(int nb_threads)
+  {
+    assert(nb_threads >= 0);
+    if(nb_threads == 0)
+      nb_threads = std::max(1, (int)thread::hardware_concurrency());
+    m_nb_threads = nb_threads;
+  }
+
+  int TFunction::nb_threads() const
+  {
+    return m_nb_threads;
+  }
+
+  const IntervalVector TFunction::eval_box(const IntervalVector& box) const
+  {
+    return m_tape ? m_tape->eval_vector(box) : m_ibex_f->eval_vector(box);
+  }
+
+  void TFunction::eval_slices_batch(const TubeVector& x, TubeVector& y) const
+  {
+    int n = x.nb_slices(), nx = x.size();
+
+    // Boxes of the envelopes and input gates of the slices, then of the last output gate:
+    // the k-th slice of x is evaluated from v_boxes[2k] and v_boxes[2k+1]
+    vector<IntervalVector> v_boxes(2 * n + 1, IntervalVector(nx + 1));
+    for(int i = 0 ; i < nx ; i++)
+    {
+      int k = 0;
+      for(const Slice *s = x[i].first_slice() ; s != NULL ; s = s->next_slice(), k++)
+      {
+        v_boxes[2*k][i+1] = s->codomain();
+        v_boxes[2*k+1][i+1] = s->input_gate();
+        if(i == 0)
+        {
+          v_boxes[2*k][0] = s->tdomain();
+          v_boxes[2*k+1][0] = s->tdomain().lb();
+        }
+      }
+      assert(k == n && "the components must share the same slicing");
+      v_boxes[2*n][i+1] = x[i].last_slice()->output_gate();
+    }
+    v_boxes[2*n][0] = x.tdomain().ub();
+
+    const vector<IntervalVector> v_results = eval_vector(v_boxes);
+
+    // The slices of y are written sequentially, as writings may update
+    // data shared by the slices (synthesis trees, caches)
+    for(int i = 0 ; i < y.size() ; i++)
+    {
+      int k = 0;
+      for(Slice *s = y[i].first_slice() ; s != NULL ; s = s->next_slice(), k++)
+      {
+        s->set_envelope(v_results[2*k][i], false);
+        s->set_input_gate(v_results[2*k+1][i], false);
+      }
+      y[i].last_slice()->set_output_gate(v_results[2*n][i], false);
+    }
+  }
+
 }
\ No newline at end of file
@@ -12,8 +12,11 @@
 #define __CODAC_TFUNCTION_H__
 
 #include <string>
+#include <vector>
+#include <memory>
 #include "codac_Function.h"
 #include "codac_TFnc.h"
+#include "codac_TFunctionTape.h"
 #include "codac_Trajectory.h"
 #include "codac_TrajectoryVector.h"
 
@@ -67,15 +70,35 @@ namespace codac
       const IntervalVector eval_vector(const IntervalVector& x) const;
       const IntervalVector eval_vector(int slice_id, const TubeVector& x) const;
       const IntervalVector eval_vector(const Interval& t, const TubeVector& x) const;
+      // Batch of boxes [t,x], evaluated with the threads of the function
+      // (if compiled, each operation of the tape is run over all the boxes)
+      const std::vector<IntervalVector> eval_vector(const std::vector<IntervalVector>& v_x) const;
 
       const TFunction diff() const;
 
+      // Jacobian matrix with respect to [t,x]
+      const IntervalMatrix jacobian(const IntervalVector& x) const;
+
+      // The expression can be compiled into a tape, then used by all the evaluations
+      // instead of the IBEX function (throws an Exception for unsupported expressions)
+      void compile();
+      bool is_compiled() const;
+
+      // Evaluations over tubes can be shared among several threads (1 by default,
+      // 0 for the number of cores). Results do not depend on the number of threads.
+      void set_nb_threads(int nb_threads);
+      int nb_threads() const;
+
     protected:
 
       void construct_from_array(int n, const char** x, const char* y);
+      void eval_slices_batch(const TubeVector& x, TubeVector& y) const;
+      const IntervalVector eval_box(const IntervalVector& box) const;
 
       Function *m_ibex_f = NULL;
       std::string m_expr; // stored here because impossible to get this value from Function
+      int m_nb_threads = 1; // number of threads for evaluations over tubes
+      std::shared_ptr<const TFunctionTape> m_tape; // compiled expression, if any (shared by the copies)
   };
 }
 
@@ -0,0 +1,643 @@
+/**
+ *  TFunctionTape class
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <map>
+#include <tuple>
+#include <cctype>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include "codac_TFunctionTape.h"
+#include "codac_IntervalArray.h"
+#include "codac_Exception.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace codac
+{
+  // Recursive descent parser, writing the operations of the expression in the tape
+
+  struct TFunctionTape::Parser
+  {
+    Parser(TFunctionTape& tape, const vector<string>& v_args, const string& expr)
+      : m_tape(tape), m_s(expr)
+    {
+      for(size_t i = 0 ; i < v_args.size() ; i++)
+      {
+        if(v_args[i].find('[') != string::npos)
+          error("vector argument " + v_args[i] + " not supported");
+        m_map_args[v_args[i]] = i;
+      }
+    }
+
+    void parse()
+    {
+      // Vector output "(e1 ; e2 ; ...)", otherwise scalar expression
+      if(peek() == '(')
+      {
+        size_t save = m_pos++;
+        vector<int> v_outputs;
+
+        while(true)
+        {
+          v_outputs.push_back(parse_sum());
+          char c = peek();
+          m_pos++;
+          if(c == ')')
+            break;
+          if(c != ';' && c != ',')
+            error("')' expected");
+        }
+
+        if(v_outputs.size() > 1 && peek() == '\0')
+        {
+          m_tape.m_v_outputs = v_outputs;
+          return;
+        }
+
+        m_pos = save; // parenthesized scalar expression
+      }
+
+      m_tape.m_v_outputs = vector<int>(1, parse_sum());
+      if(peek() != '\0')
+        error("unexpected character '" + string(1, m_s[m_pos]) + "'");
+    }
+
+    int parse_sum()
+    {
+      int r = parse_product();
+      while(peek() == '+' || peek() == '-')
+      {
+        Op op = m_s[m_pos++] == '+' ? Op::ADD : Op::SUB;
+        r = add(op, r, parse_product());
+      }
+      return r;
+    }
+
+    int parse_product()
+    {
+      int r = parse_unary();
+      while(peek() == '*' || peek() == '/')
+      {
+        Op op = m_s[m_pos++] == '*' ? Op::MUL : Op::DIV;
+        r = add(op, r, parse_unary());
+      }
+      return r;
+    }
+
+    int parse_unary()
+    {
+      if(peek() == '-')
+      {
+        m_pos++;
+        return add(Op::NEG, parse_unary());
+      }
+
+      if(peek() == '+')
+        m_pos++;
+      return parse_power();
+    }
+
+    int parse_power()
+    {
+      int r = parse_primary();
+      if(peek() != '^')
+        return r;
+
+      m_pos++;
+      int e = parse_unary(); // right associative, as "-x^2" is "-(x^2)"
+      const Instr& instr_e = m_tape.m_v_instr[e];
+      if(instr_e.op == Op::CONST && instr_e.c.is_degenerated() && instr_e.c.lb() == (int)instr_e.c.lb())
+        return add(Op::POW_INT, r, -1, (int)instr_e.c.lb());
+      return add(Op::POW, r, e);
+    }
+
+    int parse_primary()
+    {
+      char c = peek();
+
+      if(c == '(')
+      {
+        m_pos++;
+        int r = parse_sum();
+        expect(')');
+        return r;
+      }
+
+      if(c == '[') // interval constant
+      {
+        m_pos++;
+        int lb = parse_sum();
+        expect(',');
+        int ub = parse_sum();
+        expect(']');
+        if(m_tape.m_v_instr[lb].op != Op::CONST || m_tape.m_v_instr[ub].op != Op::CONST)
+          error("constant bounds expected");
+        return add_const(Interval(m_tape.m_v_instr[lb].c.lb(), m_tape.m_v_instr[ub].c.ub()));
+      }
+
+      if(isdigit(c) || c == '.')
+      {
+        const char *begin = m_s.c_str() + m_pos;
+        char *end;
+        double d = strtod(begin, &end);
+        m_pos += end - begin;
+        return add_const(Interval(d));
+      }
+
+      if(isalpha(c) || c == '_')
+      {
+        size_t begin = m_pos;
+        while(m_pos < m_s.size() && (isalnum(m_s[m_pos]) || m_s[m_pos] == '_'))
+          m_pos++;
+        string id = m_s.substr(begin, m_pos - begin);
+
+        if(peek() == '(')
+          return parse_function(id);
+
+        if(id == "pi")
+          return add_const(Interval::pi());
+
+        if(id == "oo") // infinite bound of interval constants
+          return add_const(Interval::POS_REALS);
+
+        map<string,int>::const_iterator it = m_map_args.find(id);
+        if(it == m_map_args.end())
+          error("unknown symbol " + id);
+        Instr instr;
+        instr.op = Op::ARG;
+        instr.a = it->second;
+        return insert(instr);
+      }
+
+      error(c == '\0' ? "unexpected end" : "unexpected character '" + string(1, c) + "'");
+      return -1;
+    }
+
+    int parse_function(const string& name)
+    {
+      static const map<string,Op> map_unary = {
+        {"sqr", Op::SQR}, {"sqrt", Op::SQRT}, {"exp", Op::EXP}, {"log", Op::LOG},
+        {"sin", Op::SIN}, {"cos", Op::COS}, {"tan", Op::TAN},
+        {"acos", Op::ACOS}, {"asin", Op::ASIN}, {"atan", Op::ATAN},
+        {"cosh", Op::COSH}, {"sinh", Op::SINH}, {"tanh", Op::TANH},
+        {"acosh", Op::ACOSH}, {"asinh", Op::ASINH}, {"atanh", Op::ATANH},
+        {"abs", Op::ABS}, {"sign", Op::SIGN}
+      };
+
+      static const map<string,Op> map_binary = {
+        {"atan2", Op::ATAN2}, {"min", Op::MIN}, {"max", Op::MAX}
+      };
+
+      expect('(');
+      int a = parse_sum(), r;
+
+      if(map_unary.find(name) != map_unary.end())
+        r = add(map_unary.at(name), a);
+
+      else if(map_binary.find(name) != map_binary.end())
+      {
+        expect(',');
+        r = add(map_binary.at(name), a, parse_sum());
+      }
+
+      else
+        error("unknown function " + name);
+
+      expect(')');
+      return r;
+    }
+
+    int add(Op op, int a, int b = -1, int p = 0)
+    {
+      if((op == Op::ADD || op == Op::MUL || op == Op::MIN || op == Op::MAX) && b < a)
+        swap(a, b); // commutative operations are shared whatever the order of their operands
+
+      Instr instr;
+      instr.op = op;
+      instr.a = a;
+      instr.b = b;
+      instr.p = p;
+
+      // Constant folding
+      const vector<Instr>& v = m_tape.m_v_instr;
+      if(v[a].op == Op::CONST && (b < 0 || v[b].op == Op::CONST))
+        return add_const(TFunctionTape::apply(instr, v[a].c, b < 0 ? v[a].c : v[b].c));
+
+      return insert(instr);
+    }
+
+    int add_const(const Interval& c)
+    {
+      Instr instr;
+      instr.op = Op::CONST;
+      instr.c = c;
+      return insert(instr);
+    }
+
+    int insert(const Instr& instr)
+    {
+      // Identical operations are computed once
+      bool empty = instr.c.is_empty();
+      tuple<int,int,int,int,bool,double,double> key((int)instr.op, instr.a, instr.b, instr.p,
+        empty, empty ? 0. : instr.c.lb(), empty ? 0. : instr.c.ub());
+
+      map<tuple<int,int,int,int,bool,double,double>,int>::const_iterator it = m_map_instr.find(key);
+      if(it != m_map_instr.end())
+        return it->second;
+
+      m_tape.m_v_instr.push_back(instr);
+      int i = m_tape.m_v_instr.size() - 1;
+      m_map_instr[key] = i;
+      return i;
+    }
+
+    char peek()
+    {
+      while(m_pos < m_s.size() && isspace(m_s[m_pos]))
+        m_pos++;
+      return m_pos < m_s.size() ? m_s[m_pos] : '\0';
+    }
+
+    void expect(char c)
+    {
+      if(peek() != c)
+        error("'" + string(1, c) + "' expected");
+      m_pos++;
+    }
+
+    void error(const string& msg) const
+    {
+      throw Exception("TFunctionTape", msg + " in expression \"" + m_s + "\"");
+    }
+
+    TFunctionTape& m_tape;
+    const string& m_s;
+    size_t m_pos = 0;
+    map<string,int> m_map_args;
+    map<tuple<int,int,int,int,bool,double,double>,int> m_map_instr;
+  };
+
+  namespace
+  {
+    // Computes r = f(a,b) with an interval kernel, each operand being either
+    // an array (non null pointer) or a constant. As the kernels compute in place,
+    // the array operand is first copied in the register of the result.
+    template<typename F>
+    void eval_kernel(F f, IntervalArray& r,
+      const IntervalArray *a, const Interval& c_a, const IntervalArray *b, const Interval& c_b)
+    {
+      if(a == NULL)
+      {
+        r = *b;
+        r = f(c_a, std::move(r));
+      }
+
+      else
+      {
+        r = *a;
+        r = (b == NULL) ? f(std::move(r), c_b) : f(std::move(r), *b);
+      }
+    }
+  }
+
+  // Public methods
+
+    // Definition
+
+    TFunctionTape::TFunctionTape(const vector<string>& v_args, const string& expr)
+      : m_nb_args(v_args.size())
+    {
+      Parser(*this, v_args, expr).parse();
+
+      // Removing the operations that do not contribute to the outputs
+      // (for instance, constants that have been folded)
+
+      int n = m_v_instr.size();
+      vector<bool> v_live(n, false);
+      for(int i : m_v_outputs)
+        v_live[i] = true;
+
+      for(int i = n - 1 ; i >= 0 ; i--)
+        if(v_live[i] && m_v_instr[i].op != Op::ARG && m_v_instr[i].op != Op::CONST)
+        {
+          v_live[m_v_instr[i].a] = true;
+          if(m_v_instr[i].b >= 0)
+            v_live[m_v_instr[i].b] = true;
+        }
+
+      vector<int> v_new_id(n, -1);
+      vector<Instr> v_instr;
+      for(int i = 0 ; i < n ; i++)
+        if(v_live[i])
+        {
+          Instr instr = m_v_instr[i];
+          if(instr.op != Op::ARG && instr.op != Op::CONST)
+          {
+            instr.a = v_new_id[instr.a];
+            if(instr.b >= 0)
+              instr.b = v_new_id[instr.b];
+          }
+
+          v_new_id[i] = v_instr.size();
+          v_instr.push_back(instr);
+        }
+
+      m_v_instr = v_instr;
+      for(int& i : m_v_outputs)
+        i = v_new_id[i];
+    }
+
+    int TFunctionTape::nb_args() const
+    {
+      return m_nb_args;
+    }
+
+    int TFunctionTape::image_dim() const
+    {
+      return m_v_outputs.size();
+    }
+
+    int TFunctionTape::size() const
+    {
+      return m_v_instr.size();
+    }
+
+    // Evaluations
+
+    const IntervalVector TFunctionTape::eval_vector(const IntervalVector& x) const
+    {
+      IntervalVector y(image_dim());
+      vector<Interval> v_reg(size());
+      eval_vector(x, y, v_reg);
+      return y;
+    }
+
+    void TFunctionTape::eval_vector(const IntervalVector& x, IntervalVector& y, vector<Interval>& v_reg) const
+    {
+      assert(x.size() == nb_args());
+      assert(y.size() == image_dim());
+
+      if((int)v_reg.size() < size())
+        v_reg.resize(size());
+
+      for(int i = 0 ; i < size() ; i++)
+      {
+        const Instr& instr = m_v_instr[i];
+        switch(instr.op)
+        {
+          case Op::ARG:
+            v_reg[i] = x[instr.a];
+            break;
+
+          case Op::CONST:
+            v_reg[i] = instr.c;
+            break;
+
+          default:
+            v_reg[i] = apply(instr, v_reg[instr.a], v_reg[instr.b < 0 ? instr.a : instr.b]);
+        }
+      }
+
+      for(int k = 0 ; k < image_dim() ; k++)
+        y[k] = v_reg[m_v_outputs[k]];
+    }
+
+    void TFunctionTape::eval_vector(const vector<IntervalVector>& v_x, vector<IntervalVector>& v_y, int k0, int kf) const
+    {
+      assert(k0 >= 0 && k0 <= kf && kf <= (int)v_x.size() && kf <= (int)v_y.size());
+
+      // Registers of the operations, the k-th element being the value for the
+      // k-th box of the block. Registers of constants are not used: constants
+      // are the scalar operands of the kernels.
+      vector<IntervalArray> v_reg(size());
+
+      for(int b0 = k0 ; b0 < kf ; b0 += BATCH_BLOCK_SIZE)
+      {
+        int nb = std::min((int)BATCH_BLOCK_SIZE, kf - b0);
+
+        for(int i = 0 ; i < size() ; i++)
+        {
+          const Instr& instr = m_v_instr[i];
+          IntervalArray& r = v_reg[i];
+
+          if(instr.op == Op::CONST)
+            continue;
+
+          if(instr.op == Op::ARG)
+          {
+            if(r.size() != nb)
+              r = IntervalArray(nb);
+            for(int k = 0 ; k < nb ; k++)
+            {
+              assert(v_x[b0+k].size() == nb_args());
+              r.set(k, v_x[b0+k][instr.a]);
+            }
+            continue;
+          }
+
+          // Operands, constants being only possible for binary operations (unary ones are folded)
+          int id_b = instr.b < 0 ? instr.a : instr.b;
+          const Interval& c_a = m_v_instr[instr.a].c, c_b = m_v_instr[id_b].c;
+          const IntervalArray *a = m_v_instr[instr.a].op == Op::CONST ? NULL : &v_reg[instr.a];
+          const IntervalArray *b = m_v_instr[id_b].op == Op::CONST ? NULL : &v_reg[id_b];
+
+          switch(instr.op)
+          {
+            case Op::ADD: eval_kernel(std::plus<>(), r, a, c_a, b, c_b); break;
+            case Op::SUB: eval_kernel(std::minus<>(), r, a, c_a, b, c_b); break;
+            case Op::MUL: eval_kernel(std::multiplies<>(), r, a, c_a, b, c_b); break;
+            case Op::DIV: eval_kernel(std::divides<>(), r, a, c_a, b, c_b); break;
+            case Op::NEG: r = *a; r = Interval(0.) - std::move(r); break;
+            case Op::SQR: r = *a; r = sqr(std::move(r)); break;
+            case Op::SQRT: r = *a; r = sqrt(std::move(r)); break;
+            case Op::EXP: r = *a; r = exp(std::move(r)); break;
+            case Op::LOG: r = *a; r = log(std::move(r)); break;
+            case Op::SIN: r = *a; r = sin(std::move(r)); break;
+            case Op::COS: r = *a; r = cos(std::move(r)); break;
+
+            default: // no kernel: operation computed box by box
+              if(r.size() != nb)
+                r = IntervalArray(nb);
+              for(int k = 0 ; k < nb ; k++)
+                r.set(k, apply(instr, a ? (*a)[k] : c_a, b ? (*b)[k] : c_b));
+          }
+        }
+
+        for(int k = 0 ; k < nb ; k++)
+        {
+          assert(v_y[b0+k].size() == image_dim());
+          for(int j = 0 ; j < image_dim() ; j++)
+          {
+            const Instr& instr = m_v_instr[m_v_outputs[j]];
+            v_y[b0+k][j] = instr.op == Op::CONST ? instr.c : v_reg[m_v_outputs[j]][k];
+          }
+        }
+      }
+    }
+
+    const IntervalMatrix TFunctionTape::jacobian(const IntervalVector& x) const
+    {
+      assert(x.size() == nb_args());
+
+      int n = size(), m = nb_args();
+      vector<Interval> v_reg(n);
+      vector<Interval> v_d(n * m, Interval(0.)); // v_d[i*m+j]: derivative of the register i wrt the argument j
+
+      // Forward differentiation, along with the evaluation
+      for(int i = 0 ; i < n ; i++)
+      {
+        const Instr& instr = m_v_instr[i];
+        Interval *d = &v_d[i * m];
+
+        if(instr.op == Op::ARG)
+        {
+          v_reg[i] = x[instr.a];
+          d[instr.a] = Interval(1.);
+          continue;
+        }
+
+        if(instr.op == Op::CONST)
+        {
+          v_reg[i] = instr.c;
+          continue;
+        }
+
+        const Interval& a = v_reg[instr.a];
+        const Interval& b = v_reg[instr.b < 0 ? instr.a : instr.b];
+        const Interval *da = &v_d[instr.a * m];
+        const Interval *db = &v_d[(instr.b < 0 ? instr.a : instr.b) * m];
+        v_reg[i] = apply(instr, a, b);
+        const Interval& r = v_reg[i];
+
+        switch(instr.op)
+        {
+          case Op::ADD:
+            for(int j = 0 ; j < m ; j++)
+              d[j] = da[j] + db[j];
+            break;
+
+          case Op::SUB:
+            for(int j = 0 ; j < m ; j++)
+              d[j] = da[j] - db[j];
+            break;
+
+          case Op::MUL:
+            for(int j = 0 ; j < m ; j++)
+              d[j] = da[j] * b + a * db[j];
+            break;
+
+          case Op::DIV:
+            for(int j = 0 ; j < m ; j++)
+              d[j] = (da[j] - r * db[j]) / b;
+            break;
+
+          case Op::POW:
+            for(int j = 0 ; j < m ; j++)
+              d[j] = r * (db[j] * log(a) + b * da[j] / a);
+            break;
+
+          case Op::ATAN2:
+            for(int j = 0 ; j < m ; j++)
+              d[j] = (b * da[j] - a * db[j]) / (sqr(a) + sqr(b));
+            break;
+
+          case Op::MIN:
+          case Op::MAX:
+          {
+            bool a_selected = (instr.op == Op::MIN) ? a.ub() < b.lb() : a.lb() > b.ub();
+            bool b_selected = (instr.op == Op::MIN) ? b.ub() < a.lb() : b.lb() > a.ub();
+            for(int j = 0 ; j < m ; j++)
+              d[j] = a_selected ? da[j] : (b_selected ? db[j] : (da[j] | db[j]));
+            break;
+          }
+
+          default: // unary operations: chain rule
+          {
+            Interval g;
+            switch(instr.op)
+            {
+              case Op::NEG: g = Interval(-1.); break;
+              case Op::POW_INT: g = instr.p == 0 ? Interval(0.) : instr.p * pow(a, instr.p - 1); break;
+              case Op::SQR: g = 2. * a; break;
+              case Op::SQRT: g = 0.5 / r; break;
+              case Op::EXP: g = r; break;
+              case Op::LOG: g = 1. / a; break;
+              case Op::SIN: g = cos(a); break;
+              case Op::COS: g = -sin(a); break;
+              case Op::TAN: g = 1. + sqr(r); break;
+              case Op::ACOS: g = -1. / sqrt(1. - sqr(a)); break;
+              case Op::ASIN: g = 1. / sqrt(1. - sqr(a)); break;
+              case Op::ATAN: g = 1. / (1. + sqr(a)); break;
+              case Op::COSH: g = sinh(a); break;
+              case Op::SINH: g = cosh(a); break;
+              case Op::TANH: g = 1. - sqr(r); break;
+              case Op::ACOSH: g = 1. / sqrt(sqr(a) - 1.); break;
+              case Op::ASINH: g = 1. / sqrt(sqr(a) + 1.); break;
+              case Op::ATANH: g = 1. / (1. - sqr(a)); break;
+              case Op::ABS: g = a.lb() > 0. ? Interval(1.) : (a.ub() < 0. ? Interval(-1.) : Interval(-1.,1.)); break;
+              case Op::SIGN: g = a.contains(0.) ? Interval::ALL_REALS : Interval(0.); break;
+              default: assert(false && "unhandled operation");
+            }
+
+            for(int j = 0 ; j < m ; j++)
+              d[j] = g * da[j];
+          }
+        }
+      }
+
+      IntervalMatrix jac(image_dim(), m);
+      for(int k = 0 ; k < image_dim() ; k++)
+        for(int j = 0 ; j < m ; j++)
+          jac[k][j] = v_d[m_v_outputs[k] * m + j];
+      return jac;
+    }
+
+  // Protected methods
+
+    const Interval TFunctionTape::apply(const Instr& instr, const Interval& a, const Interval& b)
+    {
+      switch(instr.op)
+      {
+        case Op::ADD: return a + b;
+        case Op::SUB: return a - b;
+        case Op::MUL: return a * b;
+        case Op::DIV: return a / b;
+        case Op::NEG: return -a;
+        case Op::POW_INT: return pow(a, instr.p);
+        case Op::POW: return pow(a, b);
+        case Op::SQR: return sqr(a);
+        case Op::SQRT: return sqrt(a);
+        case Op::EXP: return exp(a);
+        case Op::LOG: return log(a);
+        case Op::SIN: return sin(a);
+        case Op::COS: return cos(a);
+        case Op::TAN: return tan(a);
+        case Op::ACOS: return acos(a);
+        case Op::ASIN: return asin(a);
+        case Op::ATAN: return atan(a);
+        case Op::COSH: return cosh(a);
+        case Op::SINH: return sinh(a);
+        case Op::TANH: return tanh(a);
+        case Op::ACOSH: return acosh(a);
+        case Op::ASINH: return asinh(a);
+        case Op::ATANH: return atanh(a);
+        case Op::ABS: return abs(a);
+        case Op::SIGN: return sign(a);
+        case Op::ATAN2: return atan2(a, b);
+        case Op::MIN: return min(a, b);
+        case Op::MAX: return max(a, b);
+        default:
+          assert(false && "no value computed for arguments and constants");
+          return Interval::ALL_REALS;
+      }
+    }
+}
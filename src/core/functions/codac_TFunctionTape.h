@@ -0,0 +1,162 @@
+/**
+ *  \file
+ *  TFunctionTape class
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_TFUNCTIONTAPE_H__
+#define __CODAC_TFUNCTIONTAPE_H__
+
+#include <string>
+#include <vector>
+#include "codac_Interval.h"
+#include "codac_IntervalVector.h"
+#include "codac_IntervalMatrix.h"
+
+namespace codac
+{
+  /**
+   * \class TFunctionTape
+   * \brief Compiled form of an analytic expression, for fast evaluations
+   *
+   * The expression is parsed once into a flat sequence of operations (tape),
+   * in which constant subexpressions are folded and identical subexpressions
+   * are shared. An evaluation then runs through this sequence, with no
+   * expression tree to traverse and no allocation when registers are provided.
+   * The Jacobian matrix is obtained by forward differentiation on the tape.
+   * Batches of boxes are evaluated operation by operation, each operation being
+   * run over all the boxes with the interval kernels of IntervalArray.
+   *
+   * \note Supported syntax: scalar arguments, real or interval constants,
+   *       operators + - * / ^, the usual elementary functions, atan2, min, max,
+   *       and vector outputs "(e1 ; e2 ; ...)".
+   * \note Evaluations are const and can be run concurrently.
+   */
+  class TFunctionTape
+  {
+    public:
+
+      /**
+       * \brief Compiles an expression
+       *
+       * \param v_args names of the scalar arguments, in the order of the input boxes
+       * \param expr the expression, for instance "(cos(x3) ; sin(x3) ; sin(0.4*t))"
+       * \throw Exception if the expression is not supported
+       */
+      TFunctionTape(const std::vector<std::string>& v_args, const std::string& expr);
+
+      /**
+       * \brief Returns the number of arguments of the expression
+       *
+       * \return the dimension of the input boxes
+       */
+      int nb_args() const;
+
+      /**
+       * \brief Returns the dimension of the output of the expression
+       *
+       * \return the number of components
+       */
+      int image_dim() const;
+
+      /**
+       * \brief Returns the number of operations of the tape
+       *
+       * \return the size of the tape, that is also the number of registers
+       */
+      int size() const;
+
+      /**
+       * \brief Evaluates the expression over a box
+       *
+       * \param x the input box, of dimension nb_args()
+       * \return the output box
+       */
+      const IntervalVector eval_vector(const IntervalVector& x) const;
+
+      /**
+       * \brief Evaluates the expression over a box, with no allocation
+       *
+       * \param x the input box, of dimension nb_args()
+       * \param y the output box, of dimension image_dim()
+       * \param v_reg registers of the evaluation, resized to size() if needed
+       */
+      void eval_vector(const IntervalVector& x, IntervalVector& y, std::vector<Interval>& v_reg) const;
+
+      /**
+       * \brief Evaluates the expression over a range of boxes, as a batch
+       *
+       * Each operation of the tape is run over all the boxes of a block before
+       * the next operation, on registers stored as arrays of bounds (structure
+       * of arrays). Blocks are of limited size, so that the registers remain in cache.
+       *
+       * \param v_x the input boxes, of dimension nb_args()
+       * \param v_y the output boxes, of dimension image_dim(): v_y[k] is computed from v_x[k]
+       * \param k0 index of the first box to be evaluated
+       * \param kf index following the last box to be evaluated
+       */
+      void eval_vector(const std::vector<IntervalVector>& v_x, std::vector<IntervalVector>& v_y, int k0, int kf) const;
+
+      /**
+       * \brief Computes an enclosure of the Jacobian matrix of the expression over a box
+       *
+       * \param x the input box, of dimension nb_args()
+       * \return the image_dim()*nb_args() interval matrix
+       */
+      const IntervalMatrix jacobian(const IntervalVector& x) const;
+
+      /**
+       * \brief Parser of expressions (defined in the source file)
+       */
+      struct Parser;
+
+    protected:
+
+      /**
+       * \brief Operations of the tape
+       */
+      enum class Op
+      {
+        ARG, CONST, ADD, SUB, MUL, DIV, NEG, POW_INT, POW, SQR, SQRT, EXP, LOG,
+        SIN, COS, TAN, ACOS, ASIN, ATAN, COSH, SINH, TANH, ACOSH, ASINH, ATANH,
+        ABS, SIGN, ATAN2, MIN, MAX
+      };
+
+      /**
+       * \brief Operation of the tape, whose result is stored in the register
+       *        of same index
+       */
+      struct Instr
+      {
+        Op op; //!< operation
+        int a = -1, b = -1; //!< registers of the operands, or index of the argument for Op::ARG
+        int p = 0; //!< integer exponent for Op::POW_INT
+        Interval c; //!< value for Op::CONST
+      };
+
+      /**
+       * \brief Computes the result of an operation from the values of its operands
+       *
+       * \param instr the operation
+       * \param a value of the first operand
+       * \param b value of the second operand, if any
+       * \return the value of the result
+       */
+      static const Interval apply(const Instr& instr, const Interval& a, const Interval& b);
+
+      static const int BATCH_BLOCK_SIZE = 256; //!< maximal number of boxes evaluated together by a batch
+
+      // Class variables:
+
+        int m_nb_args = 0; //!< number of arguments
+        std::vector<Instr> m_v_instr; //!< operations, sorted so that operands come first
+        std::vector<int> m_v_outputs; //!< registers of the components of the output
+  };
+}
+
+#endif
@@ -469,20 +469,21 @@ namespace codac
 
     if(traj->definition_type() == TrajDefnType::MAP_OF_VALUES)
     {
-      typename map<double,double>::const_iterator it_scalar_values;
-      for(it_scalar_values = traj->sampled_map().begin(); it_scalar_values != traj->sampled_map().end(); it_scalar_values++)
+      const vector<double>& v_t = traj->sampled_times();
+      const vector<double>& v_val = traj->sampled_values();
+      for(size_t i = 0 ; i < v_t.size() ; i++)
       {
         if(m_map_trajs[traj].points_size != 0.)
-          draw_point(Point(it_scalar_values->first, it_scalar_values->second), m_map_trajs[traj].points_size, vibesParams("figure", name(), "group", group_name));
+          draw_point(Point(v_t[i], v_val[i]), m_map_trajs[traj].points_size, vibesParams("figure", name(), "group", group_name));
 
         else
         {
-          v_x.push_back(it_scalar_values->first);
-          v_y.push_back(it_scalar_values->second);
+          v_x.push_back(v_t[i]);
+          v_y.push_back(v_val[i]);
         }
 
-        viewbox[0] |= it_scalar_values->first;
-        viewbox[1] |= it_scalar_values->second;
+        viewbox[0] |= v_t[i];
+        viewbox[1] |= v_val[i];
       }
     }
 
@@ -37,14 +37,13 @@ namespace codac
       case 2:
       {
         // Points number
-        int pts_number = traj.sampled_map().size();
+        int pts_number = traj.sampled_times().size();
         bin_file.write((const char*)&pts_number, sizeof(int));
 
-        typename map<double,double>::const_iterator it_map;
-        for(it_map = traj.sampled_map().begin() ; it_map != traj.sampled_map().end() ; it_map++)
+        for(int i = 0 ; i < pts_number ; i++)
         {
-          bin_file.write((const char*)&it_map->first, sizeof(double));
-          bin_file.write((const char*)&it_map->second, sizeof(double));
+          bin_file.write((const char*)&traj.sampled_times()[i], sizeof(double));
+          bin_file.write((const char*)&traj.sampled_values()[i], sizeof(double));
         }
 
         break;
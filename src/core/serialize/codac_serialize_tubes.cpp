@@ -8,6 +8,7 @@
  *              the GNU Lesser General Public License (LGPL).
  */
 
+#include <new>
 #include "codac_serialize_tubes.h"
 #include "codac_serialize_intervals.h"
 #include "codac_Exception.h"
@@ -99,27 +100,20 @@ namespace codac
         Interval tube_tdomain(lb);
 
         Slice *prev_slice = NULL, *slice = NULL;
+        Slice *block = tube->allocate_slices(slices_number);
+        tube->m_v_slices.reserve(slices_number);
         for(int k = 0 ; k < slices_number ; k++)
         {
           double ub;
           bin_file.read((char*)&ub, sizeof(double));
           tube_tdomain |= Interval(lb, ub);
 
-          if(slice == NULL)
-          {
-            slice = new Slice(Interval(lb, ub));
-            tube->m_first_slice = slice;
-          }
-
-          else
-          {
-            slice->m_next_slice = new Slice(Interval(lb, ub));
-            slice = slice->next_slice();
-          }
+          slice = new(&block[k]) Slice(Interval(lb, ub));
+          slice->m_in_slab = true;
+          tube->m_v_slices.push_back(slice);
 
           if(prev_slice != NULL)
           {
-            delete slice->m_input_gate;
             slice->m_input_gate = NULL;
             Slice::chain_slices(prev_slice, slice);
           }
@@ -128,6 +122,8 @@ namespace codac
           lb = ub;
         }
 
+        tube->update_slicing_uniformity();
+
         // Codomains
         for(Slice *s = tube->first_slice() ; s != NULL ; s = s->next_slice())
         {
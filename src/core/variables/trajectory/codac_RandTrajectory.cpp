@@ -32,11 +32,7 @@ namespace codac
 
       double t;
       for(t = tdomain.lb() ; t < tdomain.ub()+timestep ; t+=timestep)
-      {
-        double y = Tools::rand_in_bounds(bounds);
-        m_map_values[std::min(t,tdomain.ub())] = y;
-        m_codomain |= y;
-      }
+        set(Tools::rand_in_bounds(bounds), std::min(t,tdomain.ub()));
       m_tdomain = tdomain;
 
       assert(m_codomain.is_subset(bounds));
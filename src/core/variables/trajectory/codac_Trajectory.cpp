@@ -9,11 +9,17 @@
  */
 
 #include <sstream>
+#include <utility>
+#include <algorithm>
+#include <cmath>
 #include "codac_Trajectory.h"
 
 using namespace std;
 using namespace ibex;
 
+// Number of consecutive values in the blocks of the index of extrema
+#define RANGE_INDEX_BLOCK_SIZE 32
+
 namespace codac
 {
   // Public methods
@@ -23,7 +29,7 @@ namespace codac
     Trajectory::Trajectory()
       : m_traj_def_type(TrajDefnType::MAP_OF_VALUES)
     {
-      m_map_values = map<double,double>();
+
     }
 
     Trajectory::Trajectory(const Trajectory& traj)
@@ -31,6 +37,11 @@ namespace codac
       *this = traj;
     }
 
+    Trajectory::Trajectory(Trajectory&& traj) noexcept
+    {
+      *this = std::move(traj);
+    }
+
     Trajectory::Trajectory(const Interval& tdomain, const TFunction& f)
       : m_tdomain(tdomain), m_traj_def_type(TrajDefnType::ANALYTIC_FNC), m_function(new TFunction(f))
     {
@@ -50,14 +61,20 @@ namespace codac
     }
 
     Trajectory::Trajectory(const map<double,double>& map_values)
-      : m_traj_def_type(TrajDefnType::MAP_OF_VALUES), m_map_values(map_values)
+      : m_traj_def_type(TrajDefnType::MAP_OF_VALUES)
     {
       assert(!map_values.empty());
 
+      m_v_t->reserve(map_values.size());
+      m_v_x.reserve(map_values.size());
+      for(const auto& it : map_values)
+      {
+        m_v_t->push_back(it.first);
+        m_v_x.push_back(it.second);
+      }
+
       // Temporal domain:
-      map<double,double>::const_iterator
-        last_it = map_values.end(); last_it--; // accessing last value
-      m_tdomain = Interval(map_values.begin()->first, last_it->first);
+      m_tdomain = Interval(m_v_t->front(), m_v_t->back());
 
       // Codomain:
       compute_codomain();
@@ -72,10 +89,36 @@ namespace codac
       for(list<double>::const_iterator it_t = list_t.begin(), it_x = list_x.begin() ;
           it_t != list_t.end() && it_x != list_x.end();
           ++it_t, ++it_x)
-      {
-        m_map_values[*it_t] = *it_x;
-        m_tdomain |= *it_t;
-      }
+        set(*it_x, *it_t); // the keys may not be sorted
+    }
+    
+    Trajectory::Trajectory(initializer_list<double> list_t, initializer_list<double> list_x)
+      : Trajectory(list<double>(list_t), list<double>(list_x))
+    {
+
+    }
+    
+    Trajectory::Trajectory(const Trajectory& x, const vector<double>& v_x)
+      : m_traj_def_type(TrajDefnType::MAP_OF_VALUES), m_v_t(x.m_v_t), m_v_x(v_x)
+    {
+      assert(x.m_traj_def_type == TrajDefnType::MAP_OF_VALUES);
+      assert(!v_x.empty());
+      assert(m_v_t->size() == v_x.size());
+
+      m_tdomain = x.m_tdomain;
+      compute_codomain();
+    }
+    
+    Trajectory::Trajectory(const vector<double>& v_t, const vector<double>& v_x)
+      : m_traj_def_type(TrajDefnType::MAP_OF_VALUES), m_v_t(make_shared<vector<double> >(v_t)), m_v_x(v_x)
+    {
+      assert(!v_t.empty());
+      assert(v_t.size() == v_x.size());
+      assert(is_sorted(v_t.begin(), v_t.end()) && adjacent_find(v_t.begin(), v_t.end()) == v_t.end()
+        && "time keys must be strictly increasing");
+
+      m_tdomain = Interval(m_v_t->front(), m_v_t->back());
+      compute_codomain();
     }
 
     Trajectory::~Trajectory()
@@ -98,13 +141,39 @@ namespace codac
           break;
 
         case TrajDefnType::MAP_OF_VALUES:
-          m_map_values = x.m_map_values;
+          m_v_t = x.m_v_t;
+          m_v_x = x.m_v_x;
+          m_history_limit = x.m_history_limit;
           break;
 
         default:
           assert(false && "unhandled case");
       }
 
+      clear_cache();
+      return *this;
+    }
+
+    const Trajectory& Trajectory::operator=(Trajectory&& x) noexcept
+    {
+      if(this == &x)
+        return *this;
+
+      if(m_traj_def_type == TrajDefnType::ANALYTIC_FNC)
+        delete m_function;
+
+      m_tdomain = x.m_tdomain;
+      m_codomain = x.m_codomain;
+      m_traj_def_type = x.m_traj_def_type;
+
+      m_function = x.m_function;
+      x.m_function = NULL;
+      m_v_t.swap(x.m_v_t);
+      m_v_x.swap(x.m_v_x);
+      m_history_limit = x.m_history_limit;
+      clear_cache();
+      x.clear_cache();
+
       return *this;
     }
 
@@ -128,7 +197,28 @@ namespace codac
     const map<double,double>& Trajectory::sampled_map() const
     {
       assert(m_traj_def_type == TrajDefnType::MAP_OF_VALUES);
-      return m_map_values;
+
+      if(!m_map_view_built)
+      {
+        m_map_view.clear();
+        for(size_t i = 0 ; i < m_v_t->size() ; i++)
+          m_map_view.emplace_hint(m_map_view.end(), (*m_v_t)[i], m_v_x[i]);
+        m_map_view_built = true;
+      }
+
+      return m_map_view;
+    }
+
+    const vector<double>& Trajectory::sampled_times() const
+    {
+      assert(m_traj_def_type == TrajDefnType::MAP_OF_VALUES);
+      return *m_v_t;
+    }
+
+    const vector<double>& Trajectory::sampled_values() const
+    {
+      assert(m_traj_def_type == TrajDefnType::MAP_OF_VALUES);
+      return m_v_x;
     }
 
     const TFunction* Trajectory::tfunction() const
@@ -152,22 +242,7 @@ namespace codac
           return m_function->eval(t).mid(); // /!\ an approximation is made here
 
         case TrajDefnType::MAP_OF_VALUES:
-          if(m_map_values.find(t) != m_map_values.end()) // key exists
-            return m_map_values.at(t);
-            // todo: optimize this to avoid double reading of the map?
-
-          else
-          {
-            typename map<double,double>::const_iterator it_lower, it_upper;
-            it_lower = m_map_values.lower_bound(t);
-            it_upper = it_lower;
-            it_lower--;
-
-            // Linear interpolation
-            return it_lower->second +
-                   (t - it_lower->first) * (it_upper->second - it_lower->second) /
-                   (it_upper->first - it_lower->first);
-          }
+          return interpolate(lower_index(t), t);
 
         default:
           assert(false && "unhandled case");
@@ -191,13 +266,17 @@ namespace codac
           break;
 
         case TrajDefnType::MAP_OF_VALUES:
-          eval |= (*this)(t.lb());
-          eval |= (*this)(t.ub());
+        {
+          size_t i = lower_index(t.lb()), j = lower_index(t.ub());
+          eval |= interpolate(i, t.lb());
+          eval |= interpolate(j, t.ub());
+
+          if((*m_v_t)[j] == t.ub())
+            j++;
 
-          for(map<double,double>::const_iterator it = m_map_values.lower_bound(t.lb()) ;
-              it != m_map_values.upper_bound(t.ub()) ; it++)
-            eval |= it->second;
+          eval |= range_hull(i, j);
           break;
+        }
 
         default:
           assert(false && "unhandled case");
@@ -214,7 +293,7 @@ namespace codac
           return m_function->eval(m_tdomain.lb()).mid(); // /!\ an approximation is made here
 
         case TrajDefnType::MAP_OF_VALUES:
-          return m_map_values.begin()->second;
+          return m_v_x.front();
 
         default:
           assert(false && "unhandled case");
@@ -230,7 +309,7 @@ namespace codac
           return m_function->eval(m_tdomain.ub()).mid(); // /!\ an approximation is made here
 
         case TrajDefnType::MAP_OF_VALUES:
-          return m_map_values.rbegin()->second;
+          return m_v_x.back();
 
         default:
           assert(false && "unhandled case");
@@ -248,7 +327,7 @@ namespace codac
           return m_function == NULL;
 
         case TrajDefnType::MAP_OF_VALUES:
-          return m_map_values.empty();
+          return m_v_t->empty();
 
         default:
           assert(false && "unhandled case");
@@ -266,13 +345,17 @@ namespace codac
         if(m_tdomain != x.tdomain() || m_codomain != x.codomain())
           return false;
 
-        typename map<double,double>::const_iterator it_map;
-        for(it_map = m_map_values.begin() ; it_map != m_map_values.end() ; it_map++)
+        if(m_v_t == x.m_v_t || *m_v_t == *x.m_v_t)
+          return m_v_x == x.m_v_x;
+
+        for(size_t i = 0 ; i < m_v_t->size() ; i++)
         {
-          if(x.sampled_map().find(it_map->first) == x.sampled_map().end())
+          size_t j = x.lower_index((*m_v_t)[i]);
+
+          if(j == x.m_v_t->size() || (*x.m_v_t)[j] != (*m_v_t)[i])
             return false;
 
-          if(it_map->second != x.sampled_map().at(it_map->first))
+          if(m_v_x[i] != x.m_v_x[j])
             return false;
         }
 
@@ -298,18 +381,44 @@ namespace codac
         && "Trajectory already defined by a TFunction");
       
       m_tdomain |= t;
+      detach_sampled_times();
 
-      bool update_codomain = m_map_values.find(t) != m_map_values.end() // key already exists
-            && m_codomain.contains(m_map_values.at(t)); // and new value inside codomain hull
+      if(m_v_t->empty() || t > m_v_t->back()) // chronological order: the value is appended
+      {
+        m_v_t->push_back(t);
+        m_v_x.push_back(y);
+        m_codomain |= y;
+        extend_cache();
+        apply_history_limit();
+        return;
+      }
+
+      clear_cache();
+
+      size_t i = lower_index(t);
+      bool update_codomain = false;
+
+      if((*m_v_t)[i] == t) // key already exists
+      {
+        // The new codomain may be a subset of the old one,
+        // if the previous value was a bound of the codomain hull
+        update_codomain = m_v_x[i] == m_codomain.lb() || m_v_x[i] == m_codomain.ub();
+        m_v_x[i] = y;
+      }
 
-      m_map_values.erase(t);
-      m_map_values.emplace(t, y);
+      else
+      {
+        m_v_t->insert(m_v_t->begin() + i, t);
+        m_v_x.insert(m_v_x.begin() + i, y);
+      }
 
-      if(update_codomain) // the new codomain may be a subset of the old one
+      if(update_codomain)
         compute_codomain();
 
       else
         m_codomain |= y; // simple union
+
+      apply_history_limit();
     }
 
     Trajectory& Trajectory::truncate_tdomain(const Interval& t)
@@ -322,15 +431,18 @@ namespace codac
         double y_lb = (*this)(t.lb());
         double y_ub = (*this)(t.ub());
 
-        map<double,double>::iterator it = m_map_values.begin();
-        while(it != m_map_values.end())
-        {
-          if(!t.contains(it->first)) it = m_map_values.erase(it);
-          else ++it;
-        }
+        size_t i_lb = lower_index(t.lb()), i_ub = lower_index(t.ub());
+        if(i_ub < m_v_t->size() && (*m_v_t)[i_ub] == t.ub())
+          i_ub++;
+
+        detach_sampled_times();
+        m_v_t->erase(m_v_t->begin() + i_ub, m_v_t->end());
+        m_v_x.erase(m_v_x.begin() + i_ub, m_v_x.end());
+        m_v_t->erase(m_v_t->begin(), m_v_t->begin() + i_lb);
+        m_v_x.erase(m_v_x.begin(), m_v_x.begin() + i_lb);
 
-        m_map_values[t.lb()] = y_lb; // clean truncation
-        m_map_values[t.ub()] = y_ub;
+        set(y_lb, t.lb()); // clean truncation
+        set(y_ub, t.ub());
       }
 
       m_tdomain &= t;
@@ -342,11 +454,10 @@ namespace codac
     {
       if(m_traj_def_type == TrajDefnType::MAP_OF_VALUES)
       {
-        map<double,double> map_temp = m_map_values;
-        m_map_values.clear();
-
-        for(map<double,double>::iterator it = map_temp.begin() ; it != map_temp.end() ; it++)
-          m_map_values.emplace(it->first + shift_ref, it->second);
+        detach_sampled_times();
+        for(auto& t : *m_v_t)
+          t += shift_ref;
+        clear_cache();
       }
 
       m_tdomain += shift_ref;
@@ -358,24 +469,15 @@ namespace codac
     {
       assert(dt > 0.);
 
-      map<double,double> new_map;
-      
-      if(m_traj_def_type == TrajDefnType::MAP_OF_VALUES)
-        new_map = m_map_values;
+      vector<double> v_t;
+      v_t.reserve((size_t)(m_tdomain.diam() / dt) + 2);
 
       double t;
       for(t = m_tdomain.lb() ; t < m_tdomain.ub() ; t+=dt)
-        if(new_map.find(t) == new_map.end()) // if key does not exist already
-          new_map[t] = (*this)(t); // evaluation/interpolation
-      new_map[m_tdomain.ub()] = (*this)(m_tdomain.ub());
-
-      if(m_traj_def_type == TrajDefnType::ANALYTIC_FNC)
-      {
-        m_traj_def_type = TrajDefnType::MAP_OF_VALUES;
-        delete m_function;
-      }
+        v_t.push_back(t);
+      v_t.push_back(m_tdomain.ub());
 
-      m_map_values = new_map;
+      merge_samples(v_t);
       // Note : no need to update the codomain, it will not be changed by this method.
       return *this;
     }
@@ -385,22 +487,12 @@ namespace codac
       assert(tdomain() == x.tdomain());
       assert(x.m_traj_def_type == TrajDefnType::MAP_OF_VALUES && "trajectory x has to be sampled");
       
-      map<double,double> new_map;
-
-      if(m_traj_def_type == TrajDefnType::MAP_OF_VALUES)
-        new_map = m_map_values;
-
-      for(auto const& it : x.sampled_map())
-        if(new_map.find(it.first) == new_map.end()) // if key does not exist already
-          new_map[it.first] = (*this)(it.first); // evaluation/interpolation
-
-      if(m_traj_def_type == TrajDefnType::ANALYTIC_FNC)
-      {
-        m_traj_def_type = TrajDefnType::MAP_OF_VALUES;
-        delete m_function;
-      }
+      if(m_v_t == x.m_v_t) // same time keys
+        return *this;
 
-      m_map_values = new_map;
+      merge_samples(*x.m_v_t);
+      if(*m_v_t == *x.m_v_t) // the time keys of x are shared
+        m_v_t = x.m_v_t;
       // Note : no need to update the codomain, it will not be changed by this method.
       return *this;
     }
@@ -414,24 +506,47 @@ namespace codac
       m_codomain = Interval::EMPTY_SET;
 
       double prev_value = 0., value_mod = 0.;
-      map<double,double> m_continuous_values(m_map_values);
 
-      for(const auto& it : m_map_values)
+      for(auto& x : m_v_x)
+      {
+        if(prev_value - x > periodicity.diam()*0.9)
+          value_mod += periodicity.diam();
+        else if(prev_value - x < -periodicity.diam()*0.9)
+          value_mod -= periodicity.diam();
+
+        prev_value = x;
+        x += value_mod;
+        m_codomain |= x;
+      }
+
+      clear_cache();
+      return *this;
+    }
+
+    Trajectory& Trajectory::limit_history(int nb_samples)
+    {
+      assert(m_traj_def_type == TrajDefnType::MAP_OF_VALUES
+        && "not usable for trajectories defined by TFunction");
+      assert(nb_samples >= 0);
+
+      m_history_limit = nb_samples;
+
+      if(m_history_limit != 0)
       {
-        if(!m_continuous_values.empty())
+        if(m_v_x.size() > m_history_limit)
         {
-          if(prev_value - it.second > periodicity.diam()*0.9)
-            value_mod += periodicity.diam();
-          else if(prev_value - it.second < -periodicity.diam()*0.9)
-            value_mod -= periodicity.diam();
+          size_t nb = m_v_x.size() - m_history_limit;
+          detach_sampled_times();
+          m_v_t->erase(m_v_t->begin(), m_v_t->begin() + nb);
+          discard_first_values(nb);
         }
 
-        prev_value = it.second;
-        m_continuous_values[it.first] += value_mod;
-        m_codomain |= m_continuous_values[it.first];
+        // Memory allocated once for all
+        detach_sampled_times();
+        m_v_t->reserve(2 * m_history_limit);
+        m_v_x.reserve(2 * m_history_limit);
       }
 
-      m_map_values = m_continuous_values;
       return *this;
     }
 
@@ -445,15 +560,15 @@ namespace codac
       double val;
       Trajectory x;
 
-      for(map<double,double>::const_iterator it = m_map_values.begin() ; it != m_map_values.end() ; it++)
+      for(size_t i = 0 ; i < m_v_t->size() ; i++)
       {
-        if(it == m_map_values.begin())
+        if(i == 0)
           val = c;
 
         else
-          val += (prev(it)->second + it->second) * (it->first - prev(it)->first) / 2.;
+          val += (m_v_x[i-1] + m_v_x[i]) * ((*m_v_t)[i] - (*m_v_t)[i-1]) / 2.;
 
-        x.set(val, it->first);
+        x.set(val, (*m_v_t)[i]);
       }
 
       return x;
@@ -495,18 +610,18 @@ namespace codac
 
         case TrajDefnType::MAP_OF_VALUES: // finite difference computation
         {
-          assert(m_map_values.size() > 1);
+          assert(m_v_t->size() > 1);
           
-          double prev_t = m_map_values.begin()->first;
-          for(map<double,double>::const_iterator it = m_map_values.begin() ; it != m_map_values.end() ; it++)
+          double prev_t = m_v_t->front();
+          for(double t : *m_v_t)
           {
-            double h = it->first - prev_t;
+            double h = t - prev_t;
 
             if(h == 0.) // first value
-              h = next(m_map_values.begin())->first - prev_t;
+              h = (*m_v_t)[1] - prev_t;
 
-            d.set(finite_diff(it->first, h), it->first);
-            prev_t = it->first;
+            d.set(finite_diff(t, h), t);
+            prev_t = t;
           }
 
           assert(d.tdomain() == tdomain());
@@ -524,34 +639,19 @@ namespace codac
     {
       // todo: improve this with h not symmetric?
       assert(m_traj_def_type == TrajDefnType::MAP_OF_VALUES);
-      assert(m_map_values.find(t) != m_map_values.end()); // key exists
-      assert(m_map_values.size() > 2);
+      assert(m_v_t->size() > 2);
 
-      vector<double> fwd;
-      map<double,double>::const_iterator it_fwd = m_map_values.find(t);
-      double x = it_fwd->second;
+      size_t i = lower_index(t);
+      assert(i < m_v_t->size() && (*m_v_t)[i] == t); // key exists
+      double x = m_v_x[i];
 
-      it_fwd++;
-      while(fwd.size() < 4 && it_fwd != m_map_values.end())
-      {
-        fwd.push_back(it_fwd->second);
-        it_fwd++;
-      }
+      vector<double> fwd;
+      for(size_t j = i + 1 ; fwd.size() < 4 && j < m_v_x.size() ; j++)
+        fwd.push_back(m_v_x[j]);
 
       vector<double> bwd;
-      map<double,double>::const_iterator it_bwd = m_map_values.find(t);
-
-      if(it_bwd != m_map_values.begin())
-      {
-        it_bwd--;
-        while(bwd.size() < 4)
-        {
-          bwd.push_back(it_bwd->second);
-          if(it_bwd == m_map_values.begin())
-            break;
-          it_bwd--;
-        }
-      }
+      for(size_t j = i ; bwd.size() < 4 && j > 0 ; j--)
+        bwd.push_back(m_v_x[j-1]);
 
       if(fwd.size() == bwd.size()) // central finite difference
         switch(fwd.size())
@@ -615,16 +715,16 @@ namespace codac
           break;
 
         case TrajDefnType::MAP_OF_VALUES:
-          if(x.m_map_values.size() < 10)
+          if(x.m_v_t->size() < 10)
           {
-            str << ", " << x.m_map_values.size() << " pts: { ";
-            for(map<double,double>::const_iterator it = x.m_map_values.begin() ; it != x.m_map_values.end() ; it++)
-              str << "(" << it->first << "," << it->second << ") ";
+            str << ", " << x.m_v_t->size() << " pts: { ";
+            for(size_t i = 0 ; i < x.m_v_t->size() ; i++)
+              str << "(" << (*x.m_v_t)[i] << "," << x.m_v_x[i] << ") ";
             str << "} ";
           }
 
           else
-            str << ", " << x.m_map_values.size() << " points";
+            str << ", " << x.m_v_t->size() << " points";
 
           break;
 
@@ -654,12 +754,206 @@ namespace codac
 
         case TrajDefnType::MAP_OF_VALUES:
           m_codomain = Interval::EMPTY_SET;
-          for(map<double,double>::iterator it = m_map_values.begin() ; it != m_map_values.end() ; it++)
-            m_codomain |= it->second;
+          for(double x : m_v_x)
+            m_codomain |= x;
           break;
 
         default:
           assert(false && "unhandled case");
       }
     }
+
+    size_t Trajectory::lower_index(double t) const
+    {
+      const size_t n = m_v_t->size();
+
+      if(n > 2)
+      {
+        // Guess from the mean timestep, corrected by a few steps
+        double i_guess = (n - 1) * (t - m_v_t->front()) / (m_v_t->back() - m_v_t->front());
+        size_t i = i_guess <= 0. ? 0 : (i_guess >= n ? n : (size_t)std::ceil(i_guess));
+
+        for(int k = 0 ; k < 4 ; k++)
+        {
+          if(i > 0 && (*m_v_t)[i-1] >= t)
+            i--;
+          else if(i < n && (*m_v_t)[i] < t)
+            i++;
+          else
+            return i;
+        }
+      }
+
+      // Non-uniform sampling
+      return lower_bound(m_v_t->begin(), m_v_t->end(), t) - m_v_t->begin();
+    }
+
+    double Trajectory::interpolate(size_t i, double t) const
+    {
+      assert(i < m_v_t->size());
+
+      if((*m_v_t)[i] == t) // key exists
+        return m_v_x[i];
+
+      // Linear interpolation
+      return m_v_x[i-1] +
+             (t - (*m_v_t)[i-1]) * (m_v_x[i] - m_v_x[i-1]) /
+             ((*m_v_t)[i] - (*m_v_t)[i-1]);
+    }
+
+    void Trajectory::detach_sampled_times()
+    {
+      if(m_v_t.use_count() > 1) // copy on write
+        m_v_t = make_shared<vector<double> >(*m_v_t);
+    }
+
+    const Interval Trajectory::range_hull(size_t i, size_t j) const
+    {
+      assert(i <= j && j <= m_v_x.size());
+
+      const size_t b = RANGE_INDEX_BLOCK_SIZE;
+      Interval hull = Interval::EMPTY_SET;
+
+      if(j - i <= 2*b) // direct scan
+      {
+        for( ; i < j ; i++)
+          hull |= m_v_x[i];
+        return hull;
+      }
+
+      if(m_v_range_index.empty()) // building the index: sparse table over the blocks
+      {
+        size_t nb_blocks = m_v_x.size() / b;
+        m_v_range_index.push_back(vector<Interval>(nb_blocks, Interval::EMPTY_SET));
+        for(size_t k = 0 ; k < nb_blocks * b ; k++)
+          m_v_range_index[0][k / b] |= m_v_x[k];
+
+        for(size_t l = 1 ; ((size_t)1 << l) <= nb_blocks ; l++)
+        {
+          const vector<Interval>& prev_level = m_v_range_index[l-1];
+          vector<Interval> level(nb_blocks - ((size_t)1 << l) + 1);
+          for(size_t k = 0 ; k < level.size() ; k++)
+            level[k] = prev_level[k] | prev_level[k + ((size_t)1 << (l-1))];
+          m_v_range_index.push_back(level);
+        }
+      }
+
+      // Full blocks between the values i and j, from b_i to b_j excluded
+      size_t b_i = (i + b - 1) / b, b_j = j / b;
+      assert(b_i < b_j);
+
+      for(size_t k = i ; k < b_i * b ; k++)
+        hull |= m_v_x[k];
+      for(size_t k = b_j * b ; k < j ; k++)
+        hull |= m_v_x[k];
+
+      size_t l = 0;
+      while(((size_t)1 << (l+1)) <= b_j - b_i)
+        l++;
+
+      hull |= m_v_range_index[l][b_i];
+      hull |= m_v_range_index[l][b_j - ((size_t)1 << l)];
+      return hull;
+    }
+
+    void Trajectory::clear_cache()
+    {
+      if(m_map_view_built)
+      {
+        m_map_view.clear();
+        m_map_view_built = false;
+      }
+
+      m_v_range_index.clear();
+    }
+
+    void Trajectory::extend_cache()
+    {
+      if(m_map_view_built)
+        m_map_view.emplace_hint(m_map_view.end(), m_v_t->back(), m_v_x.back());
+
+      const size_t b = RANGE_INDEX_BLOCK_SIZE;
+      if(m_v_range_index.empty() || m_v_x.size() % b != 0)
+        return; // no index, or no new complete block of values
+
+      // New block, and new ranges of 2^l blocks ending with it
+      size_t nb_blocks = m_v_x.size() / b;
+      Interval hull = Interval::EMPTY_SET;
+      for(size_t k = m_v_x.size() - b ; k < m_v_x.size() ; k++)
+        hull |= m_v_x[k];
+      m_v_range_index[0].push_back(hull);
+
+      for(size_t l = 1 ; ((size_t)1 << l) <= nb_blocks ; l++)
+      {
+        if(l == m_v_range_index.size())
+          m_v_range_index.push_back(vector<Interval>());
+
+        const vector<Interval>& prev_level = m_v_range_index[l-1];
+        size_t k = nb_blocks - ((size_t)1 << l);
+        m_v_range_index[l].push_back(prev_level[k] | prev_level[k + ((size_t)1 << (l-1))]);
+      }
+    }
+
+    void Trajectory::apply_history_limit()
+    {
+      if(m_history_limit == 0 || m_v_x.size() < 2 * m_history_limit)
+        return;
+
+      size_t nb = m_v_x.size() - m_history_limit;
+      detach_sampled_times();
+      m_v_t->erase(m_v_t->begin(), m_v_t->begin() + nb);
+      discard_first_values(nb);
+    }
+
+    void Trajectory::discard_first_values(size_t nb)
+    {
+      assert(nb < m_v_x.size());
+      assert(m_v_t->size() == m_v_x.size() - nb);
+
+      m_v_x.erase(m_v_x.begin(), m_v_x.begin() + nb);
+      m_tdomain = Interval(m_v_t->front(), m_v_t->back());
+      compute_codomain();
+      clear_cache();
+    }
+
+    void Trajectory::merge_samples(const vector<double>& v_t)
+    {
+      vector<double> new_t, new_x;
+      new_t.reserve(m_v_t->size() + v_t.size());
+      new_x.reserve(m_v_t->size() + v_t.size());
+
+      size_t i = 0;
+      for(double t : v_t)
+      {
+        for( ; i < m_v_t->size() && (*m_v_t)[i] < t ; i++)
+        {
+          new_t.push_back((*m_v_t)[i]);
+          new_x.push_back(m_v_x[i]);
+        }
+
+        if((i < m_v_t->size() && (*m_v_t)[i] == t) // key exists already
+          || (!new_t.empty() && new_t.back() == t))
+          continue;
+
+        new_t.push_back(t);
+        new_x.push_back((*this)(t)); // evaluation/interpolation
+      }
+
+      for( ; i < m_v_t->size() ; i++)
+      {
+        new_t.push_back((*m_v_t)[i]);
+        new_x.push_back(m_v_x[i]);
+      }
+
+      if(m_traj_def_type == TrajDefnType::ANALYTIC_FNC)
+      {
+        m_traj_def_type = TrajDefnType::MAP_OF_VALUES;
+        delete m_function;
+        m_function = NULL;
+      }
+
+      m_v_t = make_shared<vector<double> >(std::move(new_t));
+      m_v_x.swap(new_x);
+      clear_cache();
+    }
 }
\ No newline at end of file
@@ -14,6 +14,9 @@
 
 #include <map>
 #include <list>
+#include <vector>
+#include <initializer_list>
+#include <memory>
 #include "codac_DynamicalItem.h"
 #include "codac_TFunction.h"
 #include "codac_traj_arithmetic.h"
@@ -29,6 +32,16 @@ namespace codac
    * \class Trajectory
    * \brief One dimensional trajectory \f$x(\cdot)\f$, defined as a temporal map of values
    *
+   * The values of a sampled trajectory are stored in two contiguous arrays of
+   * times and values, sorted in chronological order. Values set in
+   * chronological order are appended in constant time. Interval evaluations
+   * over long time ranges rely on an index of the extrema of the values,
+   * built on demand.
+   *
+   * The array of times is shared between copies of a trajectory, and between
+   * trajectories built from the same time keys (for instance the components
+   * of a TrajectoryVector), until one of them modifies it (copy on write).
+   *
    * \note Use TrajectoryVector for the multi-dimensional case
    */
   class Trajectory : public DynamicalItem
@@ -80,6 +93,34 @@ namespace codac
        */
       explicit Trajectory(const std::list<double>& list_t, const std::list<double>& list_x);
 
+      /**
+       * \brief Creates a scalar trajectory \f$x(\cdot)\f$ from arrays of values
+       *
+       * \param v_t vector of time keys, sorted in strictly increasing order
+       * \param v_x vector of values, of same size
+       */
+      explicit Trajectory(const std::vector<double>& v_t, const std::vector<double>& v_x);
+
+      /**
+       * \brief Creates a scalar trajectory \f$x(\cdot)\f$ from lists of values,
+       *        for instance: Trajectory({ 0., 1., 2. }, { 3., 4., 5. })
+       *
+       * \param list_t list of time keys
+       * \param list_x list of values
+       */
+      explicit Trajectory(std::initializer_list<double> list_t, std::initializer_list<double> list_x);
+
+      /**
+       * \brief Creates a scalar trajectory \f$x(\cdot)\f$ from the time keys of
+       *        a sampled trajectory and new values
+       *
+       * \note The time keys are shared with x, not copied
+       *
+       * \param x the sampled Trajectory providing the time keys
+       * \param v_x vector of values, of same size as x.sampled_times()
+       */
+      explicit Trajectory(const Trajectory& x, const std::vector<double>& v_x);
+
       /**
        * \brief Creates a copy of a scalar trajectory \f$x(\cdot)\f$
        *
@@ -87,6 +128,15 @@ namespace codac
        */
       Trajectory(const Trajectory& traj);
 
+      /**
+       * \brief Creates a scalar trajectory by moving the definition of \f$x(\cdot)\f$, without copy
+       *
+       * \note traj is left undefined: it can then only be destroyed or assigned
+       *
+       * \param traj Trajectory to be moved
+       */
+      Trajectory(Trajectory&& traj) noexcept;
+
       /**
        * \brief Trajectory destructor
        */
@@ -100,6 +150,16 @@ namespace codac
        */
       const Trajectory& operator=(const Trajectory& x);
 
+      /**
+       * \brief Moves the definition of a Trajectory into this one, without copy
+       *
+       * \note x is left undefined: it can then only be destroyed or assigned
+       *
+       * \param x the Trajectory object to be moved
+       * \return this trajectory, with the former values/definition of x
+       */
+      const Trajectory& operator=(Trajectory&& x) noexcept;
+
       /**
        * \brief Returns the dimension of the scalar trajectory (always 1)
        *
@@ -128,10 +188,34 @@ namespace codac
       /**
        * \brief Returns the map of values, if the object is defined as a map
        *
+       * \note The map is built on demand from the sampled values and kept
+       *       until the next modification of the trajectory. Prefer
+       *       sampled_times() and sampled_values() for heavy trajectories.
+       *
+       * \warning The returned reference, and the iterators on the map, are
+       *          invalidated by any modification of the trajectory (set(),
+       *          sample(), truncate_tdomain(), shift_tdomain(), assignments,
+       *          arithmetic operations, etc.): the map is then rebuilt by the
+       *          next call. Copy the map to keep it while modifying the trajectory.
+       *
        * \return a map<t,y> of values, or an empty map
        */
       const std::map<double,double>& sampled_map() const;
 
+      /**
+       * \brief Returns the times of the sampled values, in increasing order
+       *
+       * \return a vector of time keys
+       */
+      const std::vector<double>& sampled_times() const;
+
+      /**
+       * \brief Returns the sampled values, in the order of sampled_times()
+       *
+       * \return a vector of values
+       */
+      const std::vector<double>& sampled_values() const;
+
       /**
        * \brief Returns the temporal function, if the object is an analytic trajectory
        *
@@ -217,6 +301,8 @@ namespace codac
        * \brief Sets a value \f$y\f$ at \f$t\f$: \f$x(t)=y\f$
        *
        * \note The trajectory must not be defined from an analytic function
+       * \note The value is appended in amortized constant time if \f$t\f$ is
+       *       greater than the last time key, and inserted in linear time otherwise
        *
        * \param y local value of the trajectory
        * \param t the temporal key (double, must belong to the trajectory's tdomain)
@@ -283,6 +369,22 @@ namespace codac
        */
       Trajectory& make_continuous();
 
+      /**
+       * \brief Bounds the number of sampled values kept in memory, for online
+       *        uses where values are continuously appended
+       *
+       * When the trajectory reaches \f$2n\f$ values, the \f$n\f$ oldest
+       * ones are discarded at once, so that appending a value remains of
+       * amortized constant time, with no new allocation. The tdomain of the
+       * trajectory then starts at the first kept value.
+       *
+       * \note The trajectory must not be defined from an analytic function
+       *
+       * \param nb_samples number \f$n\f$ of last values kept (0 for no limit)
+       * \return a reference to this trajectory
+       */
+      Trajectory& limit_history(int nb_samples);
+
       /// @}
       /// \name Integration
       /// @{
@@ -442,6 +544,80 @@ namespace codac
        */
       void compute_codomain();
 
+      /**
+       * \brief Returns the index of the first sampled value not before \f$t\f$
+       *
+       * The index is first guessed from the mean timestep, which makes the search
+       * constant in time for uniform samplings, and a binary search is done otherwise.
+       *
+       * \param t the temporal key
+       * \return the index of the first time key \f$\geqslant t\f$, or the number of values
+       */
+      size_t lower_index(double t) const;
+
+      /**
+       * \brief Returns the value at \f$t\f$, obtained from the sampled values
+       *        around the index given by lower_index()
+       *
+       * \param i the index of the first time key \f$\geqslant t\f$
+       * \param t the temporal key
+       * \return the (possibly interpolated) value \f$x(t)\f$
+       */
+      double interpolate(size_t i, double t) const;
+
+      /**
+       * \brief Makes the array of times owned by this trajectory only,
+       *        before a modification of the time keys
+       */
+      void detach_sampled_times();
+
+      /**
+       * \brief Returns the hull of the sampled values of indexes \f$i\f$ to \f$j-1\f$
+       *
+       * Beyond a few values, the hull is obtained in constant time from an index
+       * of the minima and maxima of the values, built on the first call.
+       *
+       * \param i index of the first value
+       * \param j index after the last value
+       * \return the interval hull of the values
+       */
+      const Interval range_hull(size_t i, size_t j) const;
+
+      /**
+       * \brief Clears the data computed on demand (map of values, index of
+       *        the extrema), before a modification of the values
+       */
+      void clear_cache();
+
+      /**
+       * \brief Updates the data computed on demand (map of values, index of
+       *        the extrema) after a value has been appended
+       */
+      void extend_cache();
+
+      /**
+       * \brief Discards the oldest values if the limit of the history is reached
+       *
+       * \note See limit_history()
+       */
+      void apply_history_limit();
+
+      /**
+       * \brief Discards the first sampled values, once the corresponding time
+       *        keys have been removed
+       *
+       * \param nb number of values to be discarded
+       */
+      void discard_first_values(size_t nb);
+
+      /**
+       * \brief Replaces the sampled values by the ones of the trajectory at the
+       *        given times, merged with the existing time keys
+       *
+       * \param v_t sorted time keys to be added
+       */
+      void merge_samples(const std::vector<double>& v_t);
+
       // Class variables:
 
         Interval m_tdomain = Interval::EMPTY_SET; //!< temporal domain \f$[t_0,t_f]\f$ of the trajectory
@@ -453,11 +629,18 @@ namespace codac
         //union
         //{
           TFunction *m_function = NULL; //!< optional pointer to the analytic expression of this trajectory
-          std::map<double,double> m_map_values; //!< optional map of values <t,y>: \f$x(t)=y\f$
+          std::shared_ptr<std::vector<double> > m_v_t = std::make_shared<std::vector<double> >(); //!< optional sorted time keys t of the values: \f$x(t)=y\f$, possibly shared
+          std::vector<double> m_v_x; //!< optional values y, in the order of m_v_t
         //};
 
+        mutable std::map<double,double> m_map_view; //!< map of values, built on demand by sampled_map()
+        mutable bool m_map_view_built = false; //!< true if m_map_view is up to date
+        mutable std::vector<std::vector<Interval> > m_v_range_index; //!< hulls of \f$2^k\f$ consecutive blocks of values at level \f$k\f$, built on demand by range_hull()
+        size_t m_history_limit = 0; //!< number of last values kept by limit_history(), 0 if unbounded
+
       friend void deserialize_Trajectory(std::ifstream& bin_file, Trajectory *&traj);
       friend void deserialize_TrajectoryVector(std::ifstream& bin_file, TrajectoryVector *&traj);
+      friend class TrajectoryVector; // for shared time keys
   };
 }
 
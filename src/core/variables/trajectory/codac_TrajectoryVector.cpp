@@ -9,6 +9,7 @@
  */
 
 #include <sstream>
+#include <utility>
 #include "codac_TrajectoryVector.h"
 
 using namespace std;
@@ -29,6 +30,7 @@ namespace codac
       : m_n(n), m_v_trajs(new Trajectory[n])
     {
       assert(n > 0);
+      share_sampled_times();
     }
 
     TrajectoryVector::TrajectoryVector(const Interval& tdomain, const TFunction& f)
@@ -59,8 +61,6 @@ namespace codac
              || size() == it_map->second.size()) && "vectors of map_values of different dimensions");
         set(it_map->second, it_map->first);
       }
-
-      // todo: optimize this by building Trajectory objects here directly?
     }
 
     TrajectoryVector::TrajectoryVector(const vector<map<double,double> >& v_map_values)
@@ -69,6 +69,7 @@ namespace codac
       assert(!v_map_values.empty());
       for(int i = 0 ; i < size() ; i++)
         (*this)[i] = Trajectory(v_map_values[i]);
+      share_sampled_times();
     }
     
     TrajectoryVector::TrajectoryVector(const list<double>& list_t, const list<Vector>& list_x)
@@ -89,8 +90,6 @@ namespace codac
         assert(it_x->size() == n);
         set(*it_x, *it_t);
       }
-
-      // todo: optimize this by building Trajectory objects here directly?
     }
 
     TrajectoryVector::TrajectoryVector(int n, const Trajectory& x)
@@ -113,6 +112,11 @@ namespace codac
       *this = traj;
     }
 
+    TrajectoryVector::TrajectoryVector(TrajectoryVector&& traj) noexcept
+    {
+      *this = std::move(traj);
+    }
+
     TrajectoryVector::~TrajectoryVector()
     {
       if(m_v_trajs != NULL)
@@ -135,6 +139,23 @@ namespace codac
       return *this;
     }
 
+    const TrajectoryVector& TrajectoryVector::operator=(TrajectoryVector&& x) noexcept
+    {
+      if(this == &x)
+        return *this;
+
+      if(m_v_trajs != NULL)
+        delete[] m_v_trajs;
+
+      m_n = x.m_n;
+      m_v_trajs = x.m_v_trajs;
+
+      x.m_n = 0;
+      x.m_v_trajs = NULL;
+
+      return *this;
+    }
+
     int TrajectoryVector::size() const
     {
       return m_n;
@@ -151,7 +172,7 @@ namespace codac
 
       int i = 0;
       for(; i < size() && i < n ; i++)
-        new_vec[i] = m_v_trajs[i];
+        new_vec[i] = std::move(m_v_trajs[i]);
 
       for(; i < n ; i++)
         new_vec[i] = Trajectory();
@@ -210,8 +231,18 @@ namespace codac
     {
       assert(tdomain().contains(t));
       Vector v(size());
-      for(int i = 0 ; i < size() ; i++)
-        v[i] = (*this)[i](t);
+
+      if(shares_sampled_times()) // one search for all the components
+      {
+        size_t i = m_v_trajs[0].lower_index(t);
+        for(int k = 0 ; k < size() ; k++)
+          v[k] = m_v_trajs[k].interpolate(i, t);
+      }
+
+      else
+        for(int i = 0 ; i < size() ; i++)
+          v[i] = (*this)[i](t);
+
       return v;
     }
     
@@ -219,8 +250,26 @@ namespace codac
     {
       assert(tdomain().is_superset(t));
       IntervalVector v(size());
-      for(int i = 0 ; i < size() ; i++)
-        v[i] = (*this)[i](t);
+
+      if(shares_sampled_times() && t != tdomain()) // one search for all the components
+      {
+        const vector<double>& v_t = *m_v_trajs[0].m_v_t;
+        size_t i = m_v_trajs[0].lower_index(t.lb()), j = m_v_trajs[0].lower_index(t.ub());
+        size_t j_end = (v_t[j] == t.ub()) ? j + 1 : j;
+
+        for(int k = 0 ; k < size() ; k++)
+        {
+          const Trajectory& x = m_v_trajs[k];
+          v[k] = x.range_hull(i, j_end);
+          v[k] |= x.interpolate(i, t.lb());
+          v[k] |= x.interpolate(j, t.ub());
+        }
+      }
+
+      else
+        for(int i = 0 ; i < size() ; i++)
+          v[i] = (*this)[i](t);
+
       return v;
     }
     
@@ -270,6 +319,19 @@ namespace codac
       return false;
     }
 
+    bool TrajectoryVector::shares_sampled_times() const
+    {
+      if(size() == 0 || m_v_trajs[0].m_traj_def_type != TrajDefnType::MAP_OF_VALUES)
+        return false;
+
+      for(int i = 1 ; i < size() ; i++)
+        if(m_v_trajs[i].m_traj_def_type != TrajDefnType::MAP_OF_VALUES
+          || m_v_trajs[i].m_v_t != m_v_trajs[0].m_v_t)
+          return false;
+
+      return true;
+    }
+
     // Setting values
 
     void TrajectoryVector::set(const Vector& y, double t)
@@ -278,11 +340,83 @@ namespace codac
       {
         m_n = y.size();
         m_v_trajs = new Trajectory[m_n];
+        share_sampled_times();
       }
 
       assert(size() == y.size());
-      for(int i = 0 ; i < size() ; i++)
-        (*this)[i].set(y[i], t);
+
+      bool same_history_limit = true;
+      for(int i = 1 ; i < size() ; i++)
+        same_history_limit &= m_v_trajs[i].m_history_limit == m_v_trajs[0].m_history_limit;
+
+      if(!shares_sampled_times() || !same_history_limit)
+      {
+        for(int i = 0 ; i < size() ; i++)
+          (*this)[i].set(y[i], t);
+        return;
+      }
+
+      // The shared time keys are updated once for all the components
+
+      if(m_v_trajs[0].m_v_t.use_count() != size()) // keys also shared outside this vector
+      {
+        shared_ptr<vector<double> > v_t = make_shared<vector<double> >(*m_v_trajs[0].m_v_t);
+        for(int i = 0 ; i < size() ; i++)
+          m_v_trajs[i].m_v_t = v_t;
+      }
+
+      vector<double>& v_t = *m_v_trajs[0].m_v_t;
+      size_t i = v_t.size();
+      bool new_key = true;
+
+      if(!v_t.empty() && t <= v_t.back())
+      {
+        i = m_v_trajs[0].lower_index(t);
+        new_key = v_t[i] != t;
+      }
+
+      if(new_key)
+        v_t.insert(v_t.begin() + i, t);
+
+      for(int k = 0 ; k < size() ; k++)
+      {
+        Trajectory& x = m_v_trajs[k];
+        x.m_tdomain |= t;
+
+        if(new_key)
+        {
+          x.m_v_x.insert(x.m_v_x.begin() + i, y[k]);
+          x.m_codomain |= y[k];
+
+          if(i == x.m_v_x.size() - 1) // appended value
+            x.extend_cache();
+          else
+            x.clear_cache();
+        }
+
+        else
+        {
+          // See Trajectory::set()
+          x.clear_cache();
+          bool update_codomain = x.m_v_x[i] == x.m_codomain.lb() || x.m_v_x[i] == x.m_codomain.ub();
+          x.m_v_x[i] = y[k];
+
+          if(update_codomain)
+            x.compute_codomain();
+          else
+            x.m_codomain |= y[k];
+        }
+      }
+
+      // See Trajectory::limit_history()
+      size_t history_limit = m_v_trajs[0].m_history_limit;
+      if(history_limit != 0 && v_t.size() >= 2 * history_limit)
+      {
+        size_t nb = v_t.size() - history_limit;
+        v_t.erase(v_t.begin(), v_t.begin() + nb);
+        for(int k = 0 ; k < size() ; k++)
+          m_v_trajs[k].discard_first_values(nb);
+      }
     }
 
     TrajectoryVector& TrajectoryVector::truncate_tdomain(const Interval& t)
@@ -292,6 +426,7 @@ namespace codac
       for(int i = 0 ; i < size() ; i++)
         if(!(*this)[i].not_defined())
           (*this)[i].truncate_tdomain(t);
+      share_sampled_times();
       return *this;
     }
 
@@ -299,6 +434,7 @@ namespace codac
     {
       for(int i = 0 ; i < size() ; i++)
         (*this)[i].shift_tdomain(shift_ref);
+      share_sampled_times();
       return *this;
     }
     
@@ -314,6 +450,7 @@ namespace codac
     {
       for(int i = 0 ; i < size() ; i++)
         (*this)[i].sample(dt);
+      share_sampled_times();
       return *this;
     }
 
@@ -321,6 +458,7 @@ namespace codac
     {
       for(int i = 0 ; i < size() ; i++)
         (*this)[i].sample(x);
+      share_sampled_times();
       return *this;
     }
 
@@ -329,6 +467,15 @@ namespace codac
       assert(size() == x.size());
       for(int i = 0 ; i < size() ; i++)
         (*this)[i].sample(x[i]);
+      share_sampled_times();
+      return *this;
+    }
+
+    TrajectoryVector& TrajectoryVector::limit_history(int nb_samples)
+    {
+      for(int i = 0 ; i < size() ; i++)
+        (*this)[i].limit_history(nb_samples);
+      share_sampled_times();
       return *this;
     }
     
@@ -385,4 +532,19 @@ namespace codac
         box[i] |= (*this)[i].codomain();
       return box;
     }
+
+    void TrajectoryVector::share_sampled_times()
+    {
+      if(size() == 0 || m_v_trajs[0].m_traj_def_type != TrajDefnType::MAP_OF_VALUES)
+        return;
+
+      const shared_ptr<vector<double> >& v_t = m_v_trajs[0].m_v_t;
+      for(int i = 1 ; i < size() ; i++)
+      {
+        Trajectory& x = m_v_trajs[i];
+        if(x.m_traj_def_type == TrajDefnType::MAP_OF_VALUES
+          && x.m_v_t != v_t && *x.m_v_t == *v_t)
+          x.m_v_t = v_t;
+      }
+    }
 }
\ No newline at end of file
@@ -32,6 +32,10 @@ namespace codac
    * \class TrajectoryVector
    * \brief n-dimensional trajectory \f$\mathbf{x}(\cdot)\f$, defined as a temporal map of vector values
    *
+   * When the components are sampled on the same time keys, these keys are
+   * stored once and shared by the components: a vector value is then set
+   * or evaluated with a single search among the keys.
+   *
    * \note Use Trajectory for the one-dimensional case
    */
   class TrajectoryVector : public DynamicalItem
@@ -104,6 +108,15 @@ namespace codac
        */
       TrajectoryVector(const TrajectoryVector& traj);
 
+      /**
+       * \brief Creates a n-dimensional trajectory by moving the components of \f$\mathbf{x}(\cdot)\f$, without copy
+       *
+       * \note traj is left without components: it can then only be destroyed or assigned
+       *
+       * \param traj TrajectoryVector to be moved
+       */
+      TrajectoryVector(TrajectoryVector&& traj) noexcept;
+
       /**
        * \brief Creates a n-dimensional trajectory with all the components initialized to \f$x(\cdot)\f$
        *
@@ -125,6 +138,16 @@ namespace codac
        */
       const TrajectoryVector& operator=(const TrajectoryVector& x);
 
+      /**
+       * \brief Moves the components of a TrajectoryVector into this one, without copy
+       *
+       * \note x is left without components: it can then only be destroyed or assigned
+       *
+       * \param x the TrajectoryVector object to be moved
+       * \return this trajectory, with the former components of x
+       */
+      const TrajectoryVector& operator=(TrajectoryVector&& x) noexcept;
+
       /**
        * \brief Returns the dimension of the trajectory
        *
@@ -256,6 +279,14 @@ namespace codac
        */
       bool operator!=(const TrajectoryVector& x) const;
 
+      /**
+       * \brief Tests whether the components of this trajectory are sampled
+       *        on time keys stored once and shared between them
+       *
+       * \return true if the time keys are shared by all the components
+       */
+      bool shares_sampled_times() const;
+
       /// @}
       /// \name Setting values
       /// @{
@@ -333,6 +364,17 @@ namespace codac
        */
       TrajectoryVector& sample(const TrajectoryVector& x);
 
+      /**
+       * \brief Bounds the number of sampled values kept in memory, for online
+       *        uses where values are continuously appended
+       *
+       * \note See Trajectory::limit_history()
+       *
+       * \param nb_samples number \f$n\f$ of last values kept (0 for no limit)
+       * \return a reference to this trajectory
+       */
+      TrajectoryVector& limit_history(int nb_samples);
+
       /// @}
       /// \name Integration
       /// @{
@@ -511,6 +553,12 @@ namespace codac
        */
       const IntervalVector codomain_box() const;
 
+      /**
+       * \brief Makes the sampled components defined on the same time keys
+       *        as the first component share its array of times
+       */
+      void share_sampled_times();
+
       // Class variables:
 
         int m_n = 0; //!< dimension of this trajectory
@@ -22,8 +22,9 @@ namespace codac
       assert(definition_type() == TrajDefnType::MAP_OF_VALUES && \
         "not supported yet for trajectories defined by a Function"); \
       \
-      for(auto& kv : m_map_values) \
-        m_map_values[kv.first] = kv.second f x; \
+      for(auto& y : m_v_x) \
+        y = y f x; \
+      clear_cache(); \
       m_codomain.fdef(x); \
       return *this; \
     } \
@@ -38,11 +39,13 @@ namespace codac
       if(definition_type() == TrajDefnType::MAP_OF_VALUES) \
         x_sampled.sample(*this); \
       \
-      map<double,double> new_map; \
-      for(auto const& it : x_sampled.sampled_map()) \
-        new_map[it.first] = (*this)(it.first) f it.second; \
+      vector<double> new_x(x_sampled.m_v_t->size()); \
+      for(size_t i = 0 ; i < new_x.size() ; i++) \
+        new_x[i] = (*this)((*x_sampled.m_v_t)[i]) f x_sampled.m_v_x[i]; \
       \
-      m_map_values = new_map; \
+      m_v_t = x_sampled.m_v_t; \
+      m_v_x.swap(new_x); \
+      clear_cache(); \
       compute_codomain(); \
       return *this; \
     } \
@@ -431,12 +431,12 @@ namespace codac
         traj_colormap = m_map_trajs[traj].color_map.second;
 
     if((*traj)[index_x].definition_type() == TrajDefnType::MAP_OF_VALUES
-        && (*traj)[index_x].sampled_map().size() != 0)
+        && (*traj)[index_x].sampled_times().size() != 0)
     {
       const Trajectory *displayed_traj_x, *displayed_traj_y;
       Trajectory *temp_displayed_traj_x = NULL, *temp_displayed_traj_y = NULL; // possibly used in case of heavy trajectories
 
-      if((*traj)[index_x].sampled_map().size() > m_traj_max_nb_disp_points) // heavy trajectories
+      if((*traj)[index_x].sampled_times().size() > m_traj_max_nb_disp_points) // heavy trajectories
       {
         // Computing a trajectory less discretized
         
@@ -460,33 +460,32 @@ namespace codac
         displayed_traj_y = &(*traj)[index_y];
       }
 
-      typename map<double,double>::const_iterator it_scalar_values_x, it_scalar_values_y;
-      it_scalar_values_x = displayed_traj_x->sampled_map().begin();
-      it_scalar_values_y = displayed_traj_y->sampled_map().begin();
+      // Sampled values read in place (x and y share the same time keys)
+      const vector<double>& v_t = displayed_traj_x->sampled_times();
+      const vector<double>& v_values_x = displayed_traj_x->sampled_values();
+      const vector<double>& v_values_y = displayed_traj_y->sampled_values();
+      assert(v_values_y.size() == v_t.size());
 
-      while(it_scalar_values_x != displayed_traj_x->sampled_map().end())
+      for(size_t i = 0 ; i < v_t.size() ; i++)
       {
-        if(m_restricted_tdomain.contains(it_scalar_values_x->first))
+        if(m_restricted_tdomain.contains(v_t[i]))
         {
           if(points_size != 0.)
-            vibes::drawPoint(it_scalar_values_x->second, it_scalar_values_y->second,
+            vibes::drawPoint(v_values_x[i], v_values_y[i],
                              points_size,
                              vibesParams("figure", name(), "group", group_name));
 
           else
           {
-            v_x.push_back(it_scalar_values_x->second);
-            v_y.push_back(it_scalar_values_y->second);
+            v_x.push_back(v_values_x[i]);
+            v_y.push_back(v_values_y[i]);
             if(m_map_trajs[traj].color == "")
-              v_colors.push_back(rgb2hex(m_map_trajs[traj].color_map.first.color(it_scalar_values_x->first, *traj_colormap)));
+              v_colors.push_back(rgb2hex(m_map_trajs[traj].color_map.first.color(v_t[i], *traj_colormap)));
           }
         }
 
-        viewbox[0] |= Interval(it_scalar_values_x->second);
-        viewbox[1] |= Interval(it_scalar_values_y->second);
-
-        it_scalar_values_x++;
-        it_scalar_values_y++;
+        viewbox[0] |= Interval(v_values_x[i]);
+        viewbox[1] |= Interval(v_values_y[i]);
       }
 
       if(temp_displayed_traj_x != NULL)
@@ -0,0 +1,186 @@
+/**
+ *  Benchmark: interval kernels on arrays and tube arithmetic
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "codac_Tube.h"
+#include "codac_IntervalArray.h"
+
+using namespace std;
+using namespace ibex;
+using namespace codac;
+
+double elapsed_ms(const chrono::steady_clock::time_point& t0)
+{
+  return chrono::duration<double,milli>(chrono::steady_clock::now() - t0).count();
+}
+
+void print(const string& name, double t_kernel, double t_ibex, int nb_runs)
+{
+  cout << "  " << setw(10) << left << name << right
+       << " kernel: " << setw(8) << t_kernel / nb_runs << " ms"
+       << "   IBEX: " << setw(8) << t_ibex / nb_runs << " ms"
+       << "   (x" << t_ibex / t_kernel << ")" << endl;
+}
+
+int main()
+{
+  const Interval tdomain(0.,1000.);
+  const double dt = 0.001;
+  const int nb_runs = 5;
+
+  Tube x(tdomain, dt, TFunction("sin(t)+[-0.1,0.1]"));
+  Tube y(tdomain, dt, TFunction("2+cos(t)+[-0.1,0.1]"));
+  const IntervalArray a = x.values(), b = y.values();
+  const int n = a.size();
+
+  vector<Interval> v_a(n), v_b(n), v_c(n);
+  for(int i = 0 ; i < n ; i++)
+  {
+    v_a[i] = a[i];
+    v_b[i] = b[i];
+  }
+
+  cout << "Tube(" << tdomain << "," << dt << "): " << x.nb_slices() << " slices" << endl;
+  cout << fixed << setprecision(2);
+
+  // Arrays of n intervals: kernels vs IBEX operations on each element
+
+  cout << "IntervalArray: " << n << " elements, mean over " << nb_runs << " runs" << endl;
+
+  double t_kernel[5] = {0.}, t_ibex[5] = {0.};
+  for(int r = 0 ; r < nb_runs ; r++)
+  {
+    IntervalArray c(a);
+    chrono::steady_clock::time_point t0 = chrono::steady_clock::now();
+    c = std::move(c) + b;
+    t_kernel[0] += elapsed_ms(t0);
+
+    t0 = chrono::steady_clock::now();
+    for(int i = 0 ; i < n ; i++)
+      v_c[i] = v_a[i] + v_b[i];
+    t_ibex[0] += elapsed_ms(t0);
+
+    c = a;
+    t0 = chrono::steady_clock::now();
+    c = std::move(c) * b;
+    t_kernel[1] += elapsed_ms(t0);
+
+    t0 = chrono::steady_clock::now();
+    for(int i = 0 ; i < n ; i++)
+      v_c[i] = v_a[i] * v_b[i];
+    t_ibex[1] += elapsed_ms(t0);
+
+    c = a;
+    t0 = chrono::steady_clock::now();
+    c = std::move(c) / b;
+    t_kernel[2] += elapsed_ms(t0);
+
+    t0 = chrono::steady_clock::now();
+    for(int i = 0 ; i < n ; i++)
+      v_c[i] = v_a[i] / v_b[i];
+    t_ibex[2] += elapsed_ms(t0);
+
+    c = a;
+    t0 = chrono::steady_clock::now();
+    c = sqr(std::move(c));
+    t_kernel[3] += elapsed_ms(t0);
+
+    t0 = chrono::steady_clock::now();
+    for(int i = 0 ; i < n ; i++)
+      v_c[i] = sqr(v_a[i]);
+    t_ibex[3] += elapsed_ms(t0);
+
+    c = b;
+    t0 = chrono::steady_clock::now();
+    c = sqrt(std::move(c));
+    t_kernel[4] += elapsed_ms(t0);
+
+    t0 = chrono::steady_clock::now();
+    for(int i = 0 ; i < n ; i++)
+      v_c[i] = sqrt(v_b[i]);
+    t_ibex[4] += elapsed_ms(t0);
+  }
+
+  const string v_names[5] = { "x+y", "x*y", "x/y", "sqr(x)", "sqrt(y)" };
+  for(int k = 0 ; k < 5 ; k++)
+    print(v_names[k], t_kernel[k], t_ibex[k], nb_runs);
+
+  // Tubes of n slices: kernels, including the copies of the values from and to
+  // the slices, vs IBEX operations on each slice (kernel constructors of Tube)
+
+  cout << "Tube: " << x.nb_slices() << " slices, mean over " << nb_runs << " runs" << endl;
+
+  double t_values = 0., t_set_values = 0.;
+  for(int k = 0 ; k < 5 ; k++)
+    t_kernel[k] = t_ibex[k] = 0.;
+
+  for(int r = 0 ; r < nb_runs ; r++)
+  {
+    chrono::steady_clock::time_point t0 = chrono::steady_clock::now();
+    IntervalArray v = x.values();
+    t_values += elapsed_ms(t0);
+
+    Tube z(x);
+    t0 = chrono::steady_clock::now();
+    z.set_values(v);
+    t_set_values += elapsed_ms(t0);
+
+    t0 = chrono::steady_clock::now();
+    Tube z1 = x + y;
+    t_kernel[0] += elapsed_ms(t0);
+
+    t0 = chrono::steady_clock::now();
+    Tube z2(x, y, [](const Interval& a, const Interval& b) { return a + b; });
+    t_ibex[0] += elapsed_ms(t0);
+
+    t0 = chrono::steady_clock::now();
+    Tube z3 = x * y;
+    t_kernel[1] += elapsed_ms(t0);
+
+    t0 = chrono::steady_clock::now();
+    Tube z4(x, y, [](const Interval& a, const Interval& b) { return a * b; });
+    t_ibex[1] += elapsed_ms(t0);
+
+    t0 = chrono::steady_clock::now();
+    Tube z5 = x / y;
+    t_kernel[2] += elapsed_ms(t0);
+
+    t0 = chrono::steady_clock::now();
+    Tube z6(x, y, [](const Interval& a, const Interval& b) { return a / b; });
+    t_ibex[2] += elapsed_ms(t0);
+
+    t0 = chrono::steady_clock::now();
+    Tube z7 = sqr(x);
+    t_kernel[3] += elapsed_ms(t0);
+
+    t0 = chrono::steady_clock::now();
+    Tube z8(x, [](const Interval& a) { return sqr(a); });
+    t_ibex[3] += elapsed_ms(t0);
+
+    t0 = chrono::steady_clock::now();
+    Tube z9 = sqrt(y);
+    t_kernel[4] += elapsed_ms(t0);
+
+    t0 = chrono::steady_clock::now();
+    Tube z10(y, [](const Interval& a) { return sqrt(a); });
+    t_ibex[4] += elapsed_ms(t0);
+  }
+
+  cout << "  values():     " << t_values / nb_runs << " ms" << endl;
+  cout << "  set_values(): " << t_set_values / nb_runs << " ms" << endl;
+  for(int k = 0 ; k < 5 ; k++)
+    print(v_names[k], t_kernel[k], t_ibex[k], nb_runs);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,103 @@
+/**
+ *  Benchmark: interpreted and compiled evaluations of TFunction objects
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include "codac_TFunction.h"
+#include "codac_TubeVector.h"
+
+using namespace std;
+using namespace ibex;
+using namespace codac;
+
+double elapsed_ms(const chrono::steady_clock::time_point& t0)
+{
+  return chrono::duration<double,milli>(chrono::steady_clock::now() - t0).count();
+}
+
+void benchmark(const string& name, const TFunction& f)
+{
+  const int nb_boxes = 100000;
+  const double dt = 0.001;
+
+  TFunction f_compiled(f);
+  f_compiled.compile();
+
+  // Evaluations over boxes [t,x]
+  IntervalVector box(f.nb_var() + 1, Interval(0.5,0.6));
+  double t_boxes[2], t_tubes[2], t_jac[2];
+
+  for(int c = 0 ; c < 2 ; c++)
+  {
+    const TFunction& fc = (c == 0) ? f : f_compiled;
+
+    chrono::steady_clock::time_point t0 = chrono::steady_clock::now();
+    double sum = 0.;
+    for(int i = 0 ; i < nb_boxes ; i++)
+    {
+      box[0] = Interval(i * dt, (i + 1) * dt);
+      sum += fc.eval_vector(box)[0].ub();
+    }
+    t_boxes[c] = elapsed_ms(t0);
+
+    // Evaluations over tubes
+    if(f.nb_var() > 0)
+    {
+      TubeVector x(Interval(0., nb_boxes * dt), dt, IntervalVector(f.nb_var(), Interval(-1.,1.)));
+      t0 = chrono::steady_clock::now();
+      TubeVector y = fc.eval_vector(x);
+      t_tubes[c] = elapsed_ms(t0);
+    }
+
+    else
+      t_tubes[c] = 0.;
+
+    t0 = chrono::steady_clock::now();
+    for(int i = 0 ; i < nb_boxes / 10 ; i++)
+    {
+      box[0] = Interval(i * dt, (i + 1) * dt);
+      sum += fc.jacobian(box)[0][0].ub();
+    }
+    t_jac[c] = elapsed_ms(t0);
+
+    if(sum == 42.) // prevents the loops from being optimized out
+      cout << sum << endl;
+  }
+
+  cout << name << ": " << f.expr() << endl;
+  cout << fixed << setprecision(2);
+  cout << "                     interpreted    compiled" << endl;
+  cout << "  " << setw(7) << nb_boxes << " boxes:    "
+       << setw(8) << t_boxes[0] << " ms" << setw(9) << t_boxes[1] << " ms" << endl;
+  if(f.nb_var() > 0)
+    cout << "  " << setw(7) << nb_boxes << " slices:   "
+         << setw(8) << t_tubes[0] << " ms" << setw(9) << t_tubes[1] << " ms" << endl;
+  cout << "  " << setw(7) << nb_boxes / 10 << " jacobians:"
+       << setw(8) << t_jac[0] << " ms" << setw(9) << t_jac[1] << " ms" << endl;
+  cout << endl;
+}
+
+int main()
+{
+  // Dynamics of the examples/brunovsky and examples/lie_group/05_loc programs
+
+  benchmark("brunovsky (truth)",
+    TFunction("(10*cos(t) ; 5*sin(2*t) ; atan2(10*cos(2*t),-10*sin(t)) ; sqrt((-10*sin(t))^2+(10*cos(2*t))^2))"));
+
+  benchmark("brunovsky (input)",
+    TFunction("10*(sin(t)*cos(t)-2*cos(2*t)*sin(2*t))/sqrt((sin(t)^2)+(cos(2*t)^2))"));
+
+  benchmark("lie_group",
+    TFunction("x1", "x2", "x3", "(cos(x3);sin(x3);sin(0.4*t))"));
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,71 @@
+/** 
+ *  Benchmark: construction, copy and destruction of a finely sliced tube
+ * ----------------------------------------------------------------------------
+ *  \date       2021
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2021 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include "codac_Tube.h"
+#include "codac_Slice.h"
+
+using namespace std;
+using namespace ibex;
+using namespace codac;
+
+double elapsed_ms(const chrono::steady_clock::time_point& t0)
+{
+  return chrono::duration<double,milli>(chrono::steady_clock::now() - t0).count();
+}
+
+int main()
+{
+  const Interval tdomain(0.,1000.);
+  const double dt = 0.001;
+  const int nb_runs = 5;
+
+  double t_constr = 0., t_copy = 0., t_destr = 0., t_ref = 0.;
+  int nb_slices = 0;
+
+  for(int i = 0 ; i < nb_runs ; i++)
+  {
+    chrono::steady_clock::time_point t0 = chrono::steady_clock::now();
+    Tube *x = new Tube(tdomain, dt, Interval(-1.,1.));
+    t_constr += elapsed_ms(t0);
+    nb_slices = x->nb_slices();
+
+    t0 = chrono::steady_clock::now();
+    Tube *y = new Tube(*x);
+    t_copy += elapsed_ms(t0);
+
+    t0 = chrono::steady_clock::now();
+    delete x;
+    delete y;
+    t_destr += elapsed_ms(t0) / 2.;
+
+    // Reference: one heap allocation per slice
+    t0 = chrono::steady_clock::now();
+    vector<Slice*> v_s(nb_slices);
+    for(int k = 0 ; k < nb_slices ; k++)
+      v_s[k] = new Slice(Interval(k*dt, (k+1)*dt), Interval(-1.,1.));
+    for(int k = 0 ; k < nb_slices ; k++)
+      delete v_s[k];
+    t_ref += elapsed_ms(t0);
+  }
+
+  cout << "Tube(" << tdomain << "," << dt << "): " << nb_slices << " slices, "
+       << "mean over " << nb_runs << " runs" << endl;
+  cout << fixed << setprecision(2);
+  cout << "  construction:        " << t_constr / nb_runs << " ms" << endl;
+  cout << "  copy:                " << t_copy / nb_runs << " ms" << endl;
+  cout << "  destruction:         " << t_destr / nb_runs << " ms" << endl;
+  cout << "  per-slice new/delete (reference): " << t_ref / nb_runs << " ms" << endl;
+
+  return EXIT_SUCCESS;
+}
@@ -84,7 +84,8 @@ namespace Catch
     class ApproxIntvVector
     {
       public:
-        explicit ApproxIntvVector(codac::IntervalVector value) :
+        explicit ApproxIntvVector(codac::IntervalVector value, double epsilon = DEFAULT_EPSILON) :
+            m_epsilon(epsilon),
             m_value(value)
         {}
 
@@ -93,7 +94,7 @@ namespace Catch
           if(lhs.size() != rhs.m_value.size())
             return false;
           for(int i = 0 ; i < rhs.m_value.size() ; i++)
-            if(lhs[i] != ApproxIntv(rhs.m_value[i]))
+            if(lhs[i] != ApproxIntv(rhs.m_value[i], rhs.m_epsilon))
               return false;
           return true;
         }
@@ -121,22 +122,24 @@ namespace Catch
         }
 
       private:
+        double m_epsilon;
         codac::IntervalVector m_value;
     };
 
     class ApproxSlice
     {
       public:
-        explicit ApproxSlice(codac::Slice value) :
+        explicit ApproxSlice(codac::Slice value, double epsilon = DEFAULT_EPSILON) :
+            m_epsilon(epsilon),
             m_value(value)
         {}
 
         friend bool operator ==(codac::Slice lhs, ApproxSlice const& rhs)
         {
           return lhs.tdomain() == ApproxIntv(rhs.m_value.tdomain()) &&
-                 lhs.codomain() == ApproxIntvVector(rhs.m_value.codomain()) &&
-                 lhs.input_gate() == ApproxIntvVector(rhs.m_value.input_gate()) &&
-                 lhs.output_gate() == ApproxIntvVector(rhs.m_value.output_gate());
+                 lhs.codomain() == ApproxIntvVector(rhs.m_value.codomain(), rhs.m_epsilon) &&
+                 lhs.input_gate() == ApproxIntvVector(rhs.m_value.input_gate(), rhs.m_epsilon) &&
+                 lhs.output_gate() == ApproxIntvVector(rhs.m_value.output_gate(), rhs.m_epsilon);
         }
 
         friend bool operator ==(ApproxSlice const& lhs, codac::Slice rhs)
@@ -162,13 +165,15 @@ namespace Catch
         }
 
       private:
+        double m_epsilon;
         codac::Slice m_value;
     };
 
     class ApproxTube
     {
       public:
-        explicit ApproxTube(codac::Tube value) :
+        explicit ApproxTube(codac::Tube value, double epsilon = DEFAULT_EPSILON) :
+            m_epsilon(epsilon),
             m_value(value)
         {}
 
@@ -180,7 +185,7 @@ namespace Catch
           const codac::Slice *s = lhs.first_slice(), *s_x = rhs.m_value.first_slice();
           while(s != NULL)
           {
-            if(*s != ApproxSlice(*s_x)) // todo
+            if(*s != ApproxSlice(*s_x, rhs.m_epsilon)) // todo
               return false;
             s = s->next_slice();
             s_x = s_x->next_slice();
@@ -212,6 +217,7 @@ namespace Catch
         }
 
       private:
+        double m_epsilon;
         codac::Tube m_value;
     };
 
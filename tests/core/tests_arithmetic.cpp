@@ -1,6 +1,8 @@
+#include <type_traits>
 #include "catch_interval.hpp"
 #include "codac_tube_arithmetic.h"
 #include "codac_traj_arithmetic.h"
+#include "codac_TubeExpr.h"
 
 using namespace Catch;
 using namespace Detail;
@@ -280,6 +282,246 @@ TEST_CASE("Arithmetic on tubes")
     CHECK(ApproxIntv(z.codomain()) == b);
   }
 
+  SECTION("Tests rvalue operands and moves")
+  {
+    Interval domain(0.,10.);
+    Tube y(domain, 0.5), z(domain, 0.25); // different slicings
+    for(Slice *s = y.first_slice() ; s != NULL ; s = s->next_slice())
+      s->set(Interval(-0.5,1.) + s->tdomain().lb());
+    for(Slice *s = z.first_slice() ; s != NULL ; s = s->next_slice())
+      s->set(Interval(0.,2.) - s->tdomain().lb());
+
+    Tube x = sin(y) + 2.*z;
+    Tube x_lvalues(domain); // computed without any temporary tube
+    {
+      const Tube sin_y = sin(y);
+      const Tube twice_z = 2.*z;
+      x_lvalues = sin_y + twice_z;
+    }
+
+    CHECK(x.nb_slices() == 40);
+    CHECK(x == x_lvalues);
+
+    for(const Slice *s = x.first_slice() ; s != NULL ; s = s->next_slice())
+    {
+      double t = s->tdomain().lb();
+      CHECK(ApproxIntv(s->codomain()) == sin(y(s->tdomain())) + 2.*z(s->tdomain()));
+      CHECK(ApproxIntv(s->input_gate()) == sin(y(t)) + 2.*z(t));
+    }
+
+    CHECK(ApproxIntv(x.last_slice()->output_gate()) == sin(y(10.)) + 2.*z(10.));
+    CHECK(-(-Tube(y)) == y);
+    CHECK(Tube(y) - Tube(y) == y - y);
+    CHECK(Interval(1.) / (Tube(z) + 3.) == 1. / (z + 3.));
+
+    Tube a(y);
+    Tube b(std::move(a));
+    CHECK(b == y);
+    CHECK(a.nb_slices() == 0);
+    a = std::move(b);
+    CHECK(a == y);
+    CHECK(b.nb_slices() == 0);
+
+    TubeVector v(2, y);
+    TubeVector w(std::move(v));
+    CHECK(v.size() == 0);
+    CHECK(w.size() == 2);
+    CHECK(w[1] == y);
+
+    Trajectory traj(domain, TFunction("t^2"));
+    Trajectory traj_moved(std::move(traj));
+    CHECK(traj_moved(2.) == 4.);
+    traj = std::move(traj_moved);
+    CHECK(traj(3.) == 9.);
+  }
+
+  SECTION("Tests interval kernels")
+  {
+    vector<Interval> v_x({ Interval(1.,2.), Interval(-3.,0.5), Interval(0.1,0.3), Interval(2.),
+      Interval::EMPTY_SET, Interval(-1.,POS_INFINITY), Interval(-0.4,-0.2), Interval(0.,1.5) });
+    Interval c(-2.,0.5);
+
+    IntervalArray x((int)v_x.size());
+    for(size_t i = 0 ; i < v_x.size() ; i++)
+      x.set(i, v_x[i]);
+
+    // Results of the kernels enclose the IBEX ones (outward rounding),
+    // and are as tight (up to the rounding)
+
+    IntervalArray y = IntervalArray(x) + x;
+    for(int i = 0 ; i < x.size() ; i++)
+      CHECK(y[i] == x[i] + x[i]); // exact sums, or evaluated by IBEX
+
+    y = IntervalArray(x) * c;
+    for(int i = 0 ; i < x.size() ; i++)
+    {
+      CHECK(y[i].is_superset(x[i] * c));
+      CHECK(ApproxIntv(y[i]) == x[i] * c);
+    }
+
+    y = IntervalArray(x) * x;
+    for(int i = 0 ; i < x.size() ; i++)
+    {
+      CHECK(y[i].is_superset(x[i] * x[i]));
+      CHECK(ApproxIntv(y[i]) == x[i] * x[i]);
+    }
+
+    y = c / IntervalArray(x); // divisions by intervals containing 0 evaluated by IBEX
+    for(int i = 0 ; i < x.size() ; i++)
+    {
+      CHECK(y[i].is_superset(c / x[i]));
+      CHECK(ApproxIntv(y[i]) == c / x[i]);
+    }
+
+    y = IntervalArray(x) / Interval(3.,7.);
+    for(int i = 0 ; i < x.size() ; i++)
+    {
+      CHECK(y[i].is_superset(x[i] / Interval(3.,7.)));
+      CHECK(ApproxIntv(y[i]) == x[i] / Interval(3.,7.));
+    }
+
+    y = IntervalArray(x) - Interval(0.1);
+    for(int i = 0 ; i < x.size() ; i++)
+      CHECK(y[i].is_superset(x[i] - Interval(0.1)));
+    CHECK(y[0].contains(1.-0.1));
+    CHECK(y[0].contains(2.-0.1));
+    CHECK(y[3].lb() < y[3].ub());
+
+    y = sqrt(IntervalArray(x));
+    CHECK(y[2].contains(std::sqrt(0.1)));
+    CHECK(y[3].lb() < y[3].ub()); // outward rounding
+    CHECK(y[3].lb() * y[3].lb() <= 2.);
+    CHECK(y[3].ub() * y[3].ub() >= 2.);
+    CHECK(y[4] == Interval::EMPTY_SET);
+
+    typedef IntervalArray (*Kernel)(IntervalArray&&);
+    typedef Interval (*Function)(const Interval&);
+    vector<pair<Kernel,Function> > v_f({
+      make_pair((Kernel)codac::sqr, (Function)ibex::sqr), make_pair((Kernel)codac::sqrt, (Function)ibex::sqrt) });
+
+    for(const auto& f : v_f)
+    {
+      y = f.first(IntervalArray(x));
+      for(int i = 0 ; i < x.size() ; i++)
+      {
+        CHECK(y[i].is_superset(f.second(x[i])));
+        CHECK(ApproxIntv(y[i]) == f.second(x[i]));
+      }
+    }
+
+    // Functions of the C library are not correctly rounded: evaluated by IBEX
+    v_f = vector<pair<Kernel,Function> >({
+      make_pair((Kernel)codac::exp, (Function)ibex::exp), make_pair((Kernel)codac::log, (Function)ibex::log),
+      make_pair((Kernel)codac::sin, (Function)ibex::sin), make_pair((Kernel)codac::cos, (Function)ibex::cos) });
+
+    for(const auto& f : v_f)
+    {
+      y = f.first(IntervalArray(x));
+      for(int i = 0 ; i < x.size() ; i++)
+        CHECK(y[i] == f.second(x[i]));
+    }
+  }
+
+  SECTION("Tests kernel constructors")
+  {
+    Tube y(Interval(0.,10.), 0.5);
+    for(Slice *s = y.first_slice() ; s != NULL ; s = s->next_slice())
+      s->set(Interval(-0.5,1.) + s->tdomain().lb());
+    y.set(Interval(-1.,0.), 0.);
+
+    Tube x(y, [](const Interval& a) { return exp(a); });
+    CHECK(Tube::same_slicing(x, y));
+    CHECK(x == exp(Tube(y)));
+    CHECK(x(3) == exp(y(3)));
+    CHECK(x(0.) == exp(Interval(-0.5,0.))); // gate bounded by its slice
+    CHECK(x(10.) == exp(y(10.)));
+
+    Tube z(x, y, [](const Interval& a, const Interval& b) { return a - b; });
+    CHECK((Tube(x) - y).is_superset(z)); // computed by the interval kernels
+    CHECK((x * y).is_superset(Tube(x, y, [](const Interval& a, const Interval& b) { return a * b; })));
+    CHECK((x / y).is_superset(Tube(x, y, [](const Interval& a, const Interval& b) { return a / b; })));
+    CHECK(sqr(y).is_superset(Tube(y, [](const Interval& a) { return sqr(a); })));
+    CHECK(z(0.) == x(0.) - y(0.));
+    CHECK(z(2.5) == x(2.5) - y(2.5));
+    CHECK(z(10.) == x(10.) - y(10.));
+    CHECK(min(x, y) == min(Tube(x), y));
+    CHECK(pow(y, 2) == pow(Tube(y), 2));
+    CHECK(2. * y == 2. * Tube(y));
+  }
+
+  SECTION("Tests in-place functions")
+  {
+    Tube x(Interval(0.,10.), 0.5);
+    for(Slice *s = x.first_slice() ; s != NULL ; s = s->next_slice())
+      s->set(Interval(-0.5,1.) + s->tdomain().lb());
+
+    Tube y(x);
+    y.apply([](const Interval& a) { return sin(a); });
+    CHECK(y == ApproxTube(sin(x)));
+    CHECK(y(0.) == sin(x(0.)));
+    CHECK(y(10.) == sin(x(10.)));
+
+    Tube z(x);
+    const Slice *s_z = z.first_slice();
+    z.apply(y, [](const Interval& a) { return sqr(a) + 1.; });
+    CHECK(z.first_slice() == s_z); // slices reused
+    CHECK(z == ApproxTube(sqr(y) + 1.));
+    CHECK(z(10.) == sqr(y(10.)) + 1.);
+
+    TubeVector v(2, x);
+    v.apply([](const Interval& a) { return exp(a); });
+    CHECK(v[0] == ApproxTube(exp(x), 1e-9));
+    CHECK(v[1] == ApproxTube(exp(x), 1e-9));
+    TubeVector w(2, x);
+    w.apply(v, [](const Interval& a) { return -a; });
+    CHECK(w == -v);
+    CHECK(abs(w) == v);
+  }
+
+  SECTION("Tests lazy expressions")
+  {
+    Interval domain(0.,10.);
+    Tube x(domain, 0.5), v(domain, 0.5), z(domain, 0.5);
+    for(Slice *s = x.first_slice() ; s != NULL ; s = s->next_slice())
+    {
+      s->set(Interval(-0.5,1.) + s->tdomain().lb());
+      v.slice(s->tdomain().mid())->set(Interval(-1.,2.) - s->tdomain().lb());
+      z.slice(s->tdomain().mid())->set(Interval(0.,0.1) * s->tdomain().lb());
+    }
+    Trajectory traj(domain, TFunction("-t"));
+
+    Tube y = (2.*sin(TubeExpr(x)) + sqr(TubeExpr(v)) - z).eval();
+    CHECK(Tube::same_slicing(y, x));
+    CHECK(y == ApproxTube(2.*sin(x) + sqr(v) - z));
+    CHECK(y(3) == 2.*sin(x(3)) + sqr(v(3)) - z(3));
+    CHECK(y(0.) == 2.*sin(x(0.)) + sqr(v(0.)) - z(0.));
+    CHECK(y(10.) == 2.*sin(x(10.)) + sqr(v(10.)) - z(10.));
+
+    Tube w = (min(pow(TubeExpr(x), 2), Interval(0.,5.)) | -TubeExpr(z) | TubeExpr(traj)).eval();
+    CHECK(w == (min(pow(x, 2), Interval(0.,5.)) | -z | traj));
+
+    CHECK_THROWS(TubeExpr(traj).eval()); // no tube to define the slicing
+
+    // Tubes of different slicings, evaluated on their common slicing
+    Tube u(domain, 0.3);
+    for(Slice *s = u.first_slice() ; s != NULL ; s = s->next_slice())
+      s->set(Interval(0.,0.2) + s->tdomain().ub());
+
+    Tube e = (TubeExpr(x) * TubeExpr(u) - TubeExpr(z)).eval();
+    CHECK(Tube::same_slicing(e, x * u - z)); // slicing of the eager operators
+    CHECK(e == ApproxTube(x * u - z));
+    CHECK(e(5.) == ApproxIntv(x(5.) * u(5.) - z(5.))); // no gate of u at t=5
+    CHECK(x.nb_slices() == 20); // operands not resampled
+
+    Tube x_short(Interval(0.,5.), 0.5);
+    CHECK_THROWS((TubeExpr(x) + TubeExpr(x_short)).eval()); // different tdomains
+
+    // Temporary operands would not exist anymore at the evaluation
+    CHECK_FALSE((is_constructible<TubeExpr,Tube&&>::value));
+    CHECK_FALSE((is_constructible<TubeExpr,Trajectory&&>::value));
+    CHECK((is_constructible<TubeExpr,const Tube&>::value));
+  }
+
   SECTION("Tests vector tube")
   {
     Interval domain(0.,10.);
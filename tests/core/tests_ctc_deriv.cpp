@@ -395,4 +395,99 @@ TEST_CASE("CtcDeriv")
     CHECK(x.interpol(Interval(1.), v) == Interval(-1.));
     CHECK(x.interpol(Interval(-1.,3.), v) == Interval(-3.,1.));
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("CtcDeriv, incremental mode")
+{
+  SECTION("Recording of the modified slices")
+  {
+    Tube x(Interval(0.,100.), 1., Interval(-100.,100.));
+    int i0, i1;
+    CHECK(x.modified_slices(0, i0, i1)); // writings not recorded yet
+    CHECK(i0 == 0);
+    CHECK(i1 == 99);
+
+    unsigned long epoch = x.write_epoch();
+    CHECK_FALSE(x.modified_slices(epoch, i0, i1));
+
+    x.slice(40)->set_envelope(Interval(-50.,50.));
+    CHECK(x.modified_slices(epoch, i0, i1));
+    CHECK(i0 == 32);
+    CHECK(i1 == 63);
+
+    x.slice(99)->set_output_gate(Interval(0.));
+    CHECK(x.modified_slices(epoch, i0, i1));
+    CHECK(i0 == 32);
+    CHECK(i1 == 99);
+
+    epoch = x.write_epoch();
+    CHECK_FALSE(x.modified_slices(epoch, i0, i1));
+
+    x.sample(10.5); // change of slicing
+    CHECK(x.modified_slices(epoch, i0, i1));
+    CHECK(i0 == 0);
+    CHECK(i1 == 100);
+  }
+
+  SECTION("Same contractions as full sweeps")
+  {
+    Tube x(Interval(0.,100.), 1., Interval(-100.,100.));
+    Tube v(Interval(0.,100.), 1., Interval(-1.,1.));
+    x.set(Interval(0.), 0.);
+    Tube y(x);
+
+    CtcDeriv ctc, ctc_incremental;
+    ctc_incremental.set_incremental_mode();
+
+    ctc.contract(y, v);
+    ctc_incremental.contract(x, v); // first call: full sweep
+    CHECK(x == y);
+    CHECK(x(30.) == Interval(-30.,30.));
+
+    // Local addition of data
+    x.set(Interval(10.), 50.);
+    y.set(Interval(10.), 50.);
+    ctc.contract(y, v);
+    ctc_incremental.contract(x, v);
+    CHECK(x == y);
+    CHECK(x(45.5) == Interval(5.,15.));
+
+    // No modification since the last contraction
+    unsigned long epoch = x.write_epoch();
+    int i0, i1;
+    ctc_incremental.contract(x, v);
+    CHECK_FALSE(x.modified_slices(epoch, i0, i1));
+
+    // Modification of the derivative
+    v.slice(80)->set_envelope(Interval(0.));
+    ctc.contract(y, v);
+    ctc_incremental.contract(x, v);
+    CHECK(x == y);
+    CHECK(x(80.5) == x(80.));
+  }
+
+  SECTION("Many contracted tubes")
+  {
+    Tube v(Interval(0.,10.), 1., Interval(-1.,1.));
+    vector<Tube> v_x(100, Tube(Interval(0.,10.), 1., Interval(-100.,100.)));
+    CtcDeriv ctc_incremental;
+    ctc_incremental.set_incremental_mode();
+
+    for(Tube& x : v_x)
+    {
+      x.set(Interval(0.), 0.);
+      ctc_incremental.contract(x, v);
+    }
+
+    // The epoch of the first tube has been forgotten: full sweep
+    for(Tube& x : v_x)
+    {
+      x.set(Interval(5.), 5.);
+      Tube y(x);
+      CtcDeriv().contract(y, v);
+      ctc_incremental.contract(x, v);
+      CHECK(x == y);
+      CHECK(x(4.5) == Interval(4.,5.));
+    }
+  }
+}
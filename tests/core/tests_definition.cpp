@@ -202,6 +202,64 @@ TEST_CASE("Tube definition")
     CHECK(tube2.is_strict_subset(tube1));
   }
 
+  SECTION("Tube class - sampled Trajectory")
+  {
+    // Non-uniform sampling, not aligned with the slices
+    Trajectory traj_lb, traj_ub;
+    for(double t = 0. ; t < 10. ; t += 0.013 + 0.01 * std::cos(3.*t))
+    {
+      traj_lb.set(std::sin(t), t);
+      traj_ub.set(std::sin(t) + 0.5 + 0.1 * std::cos(7.*t), t);
+    }
+    traj_lb.set(std::sin(10.), 10.);
+    traj_ub.set(std::sin(10.) + 0.5, 10.);
+    traj_ub.set(2., 0.5); // additional value
+
+    for(double dt : { 0., 0.001, 0.1, 0.7 })
+    {
+      Tube x(traj_lb, dt);
+      Tube x_union(traj_lb.tdomain(), dt, Interval::EMPTY_SET);
+      x_union |= traj_lb;
+      CHECK(x == x_union);
+
+      Tube y(traj_lb, traj_ub, dt);
+      x_union |= traj_ub;
+      CHECK(y == x_union);
+      CHECK(y(0.5).ub() == 2.);
+    }
+
+    // Components built in parallel, compared with the hulls of trajectories
+    TrajectoryVector traj_v(3);
+    for(int i = 0 ; i <= 10000 ; i++)
+    {
+      double t = i * 0.001;
+      traj_v.set(Vector({ std::cos(t), std::sin(2.*t), t }), t);
+    }
+
+    TubeVector x_v(traj_v, 0.002);
+    TubeVector x_union_v(traj_v.tdomain(), 0.002, IntervalVector(3, Interval::EMPTY_SET));
+    x_union_v |= traj_v;
+    CHECK(x_v == x_union_v);
+
+    TrajectoryVector traj_v_ub = traj_v + Vector(3, 1.);
+    TubeVector y_v(traj_v, traj_v_ub, 0.002);
+    x_union_v |= traj_v_ub;
+    CHECK(y_v == x_union_v);
+
+    int nb_threads = TubeVector::nb_threads();
+    CHECK(nb_threads >= 1);
+    for(int n : {1, 2, 5})
+    {
+      TubeVector::set_nb_threads(n);
+      CHECK(TubeVector::nb_threads() == n);
+      CHECK(TubeVector(traj_v, 0.002) == x_v);
+      CHECK(TubeVector(traj_v, traj_v_ub, 0.002) == y_v);
+    }
+
+    TubeVector::set_nb_threads(0);
+    CHECK(TubeVector::nb_threads() == nb_threads);
+  }
+
   SECTION("Tube class - vector of boxes")
   {
     IntervalVector box1(2), box2(2), box3(2), box4(2);
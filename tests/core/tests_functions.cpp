@@ -62,4 +62,143 @@ TEST_CASE("Functions")
       CHECK(f.eval_vector(box_i.subvector(1,2)) == tf.eval_vector(box_i));
     }
   }
-}
\ No newline at end of file
+
+  SECTION("Parallel evaluations over tubes")
+  {
+    TubeVector x(Interval(0.,10.), 0.01, TFunction("(sin(t)+[-0.01,0.01] ; t*cos(t))"));
+    TFunction f("x1", "x2", "(x1+sin(t)*x2 ; x2^2 ; exp(x1))");
+    TubeVector y1 = f.eval_vector(x);
+    CHECK(f.nb_threads() == 1);
+
+    for(int nb_threads : {2, 3, 7})
+    {
+      f.set_nb_threads(nb_threads);
+      TubeVector y2 = f.eval_vector(x);
+      CHECK(Tube::same_slicing(y1[0], y2[0]));
+      CHECK(y2 == y1);
+      CHECK(y2(x.tdomain().lb()) == y1(x.tdomain().lb()));
+      CHECK(y2(x.tdomain().ub()) == y1(x.tdomain().ub()));
+    }
+
+    TFunction g(f); // the number of threads is copied
+    CHECK(g.nb_threads() == 7);
+    g.set_nb_threads(0);
+    CHECK(g.nb_threads() >= 1);
+    CHECK(g.eval_vector(x) == y1);
+  }
+
+  SECTION("Batched evaluations")
+  {
+    TFunction f("x1", "x2", "(x1+sin(t)*x2 ; x2^2)");
+    vector<IntervalVector> v_x;
+    for(int i = 0 ; i < 50 ; i++)
+    {
+      IntervalVector box_i({Interval(i*0.1), cos(i*0.5), sin(i*0.5)});
+      box_i.inflate(0.2);
+      v_x.push_back(box_i);
+    }
+
+    vector<IntervalVector> v_y = f.eval_vector(v_x);
+    CHECK(v_y.size() == v_x.size());
+    for(size_t i = 0 ; i < v_x.size() ; i++)
+      CHECK(v_y[i] == f.eval_vector(v_x[i]));
+
+    f.set_nb_threads(4);
+    CHECK(f.eval_vector(v_x) == v_y);
+    CHECK(f.eval_vector(vector<IntervalVector>()).empty());
+  }
+
+  SECTION("Compiled evaluations")
+  {
+    vector<TFunction> v_f;
+    v_f.push_back(TFunction("(10*cos(t) ; 5*sin(2*t) ; atan2(10*cos(2*t),-10*sin(t)) ; sqrt((-10*sin(t))^2+(10*cos(2*t))^2))"));
+    v_f.push_back(TFunction("x1", "x2", "x3", "(cos(x3);sin(x3);sin(0.4*t))"));
+    v_f.push_back(TFunction("x1", "x2", "x1+sin(t)*x2+[-0.01,0.01]"));
+    v_f.push_back(TFunction("x", "y", "(max(x,y)-min(x^3,exp(-y)) ; abs(x)/(1+y^2) ; tanh(x*y)-2^x)"));
+
+    for(TFunction& f : v_f)
+    {
+      TFunction f_compiled(f);
+      CHECK(!f_compiled.is_compiled());
+      f_compiled.compile();
+      CHECK(f_compiled.is_compiled());
+      CHECK(f_compiled.image_dim() == f.image_dim());
+
+      for(int i = 0 ; i < 20 ; i++)
+      {
+        IntervalVector box(f.nb_var() + 1);
+        for(int j = 0 ; j < box.size() ; j++)
+          box[j] = Interval(cos(i + j) + 0.5 * j).inflate(0.1 * (i % 3));
+        CHECK(f_compiled.eval_vector(box) == ApproxIntvVector(f.eval_vector(box)));
+      }
+
+      // Batch evaluated by blocks of the tape, the last block being partial
+      vector<IntervalVector> v_boxes;
+      for(int i = 0 ; i < 600 ; i++)
+      {
+        IntervalVector box(f.nb_var() + 1);
+        for(int j = 0 ; j < box.size() ; j++)
+          box[j] = Interval(cos(i + j) + 0.5 * j).inflate(0.1 * (i % 3));
+        if(i % 50 == 7)
+          box[box.size() - 1] = (i % 100 == 7) ? Interval::EMPTY_SET : Interval(-1.,1.);
+        v_boxes.push_back(box);
+      }
+
+      vector<IntervalVector> v_y = f_compiled.eval_vector(v_boxes);
+      REQUIRE(v_y.size() == v_boxes.size());
+      for(size_t i = 0 ; i < v_boxes.size() ; i++)
+        CHECK(v_y[i] == ApproxIntvVector(f.eval_vector(v_boxes[i])));
+
+      f_compiled.set_nb_threads(3);
+      CHECK(f_compiled.eval_vector(v_boxes) == v_y);
+      f_compiled.set_nb_threads(1);
+
+      if(f.nb_var() == 0)
+        continue;
+
+      TubeVector x(Interval(0.,10.), 0.1, f.nb_var());
+      x.set(IntervalVector(x.size(), Interval(0.5,1.)));
+      x.set(IntervalVector(x.size(), Interval(0.8)), 0.);
+      TubeVector y = f_compiled.eval_vector(x);
+      CHECK(y.volume() == Approx(f.eval_vector(x).volume()));
+      f_compiled.set_nb_threads(3);
+      CHECK(f_compiled.eval_vector(x) == y);
+    }
+
+    // Jacobian by forward differentiation
+    TFunction f("x1", "x2", "(x1*x2+sin(t) ; x1^3/x2 ; atan2(x2,x1))");
+    f.compile();
+    IntervalVector box({Interval(0.5), Interval(2.), Interval(3.)});
+    IntervalMatrix jac = f.jacobian(box);
+    CHECK(jac.nb_rows() == 3);
+    CHECK(jac.nb_cols() == 3);
+    CHECK(jac[0][0] == ApproxIntv(cos(Interval(0.5))));
+    CHECK(jac[0][1] == ApproxIntv(Interval(3.)));
+    CHECK(jac[0][2] == ApproxIntv(Interval(2.)));
+    CHECK(jac[1][0] == Interval(0.));
+    CHECK(jac[1][1] == ApproxIntv(Interval(3.*4./3.)));
+    CHECK(jac[1][2] == ApproxIntv(Interval(-8./9.)));
+    CHECK(jac[2][1] == ApproxIntv(Interval(-3./13.)));
+    CHECK(jac[2][2] == ApproxIntv(Interval(2./13.)));
+
+    // Tape with shared subexpressions and folded constants
+    TFunctionTape tape({"t", "x"}, "(sin(x)+2*3*sin(x) ; sin(x)^2)");
+    CHECK(tape.nb_args() == 2);
+    CHECK(tape.image_dim() == 2);
+    CHECK(tape.size() == 6); // x, sin(x), 6, sin(x)*6, sum, sin(x)^2
+
+    // Batch restricted to a range of boxes
+    vector<IntervalVector> v_x(4, IntervalVector({Interval(0.), Interval(0.5,1.)}));
+    vector<IntervalVector> v_y(4, IntervalVector(2, Interval(-1.)));
+    tape.eval_vector(v_x, v_y, 1, 3);
+    CHECK(v_y[0] == IntervalVector(2, Interval(-1.)));
+    CHECK(v_y[1] == ApproxIntvVector(tape.eval_vector(v_x[1])));
+    CHECK(v_y[2] == ApproxIntvVector(tape.eval_vector(v_x[2])));
+    CHECK(v_y[3] == IntervalVector(2, Interval(-1.)));
+
+    CHECK_THROWS(TFunctionTape({"t", "x"}, "y+1"));
+    CHECK_THROWS(TFunctionTape({"t", "x"}, "foo(x)"));
+    CHECK_THROWS(TFunctionTape({"t", "x[2]"}, "x[0]"));
+    CHECK_THROWS(TFunctionTape({"t", "x"}, "(x+1"));
+  }
+}
@@ -1,4 +1,8 @@
 #include "catch_interval.hpp"
+#include "codac_TubeSnapshot.h"
+#include "codac_SlidingTube.h"
+#include "codac_SlidingTubeVector.h"
+#include "codac_CtcDeriv.h"
 #include "tests_predefined_tubes.h"
 
 using namespace Catch;
@@ -45,6 +49,36 @@ TEST_CASE("time_to_index")
     CHECK(tube.nb_slices() == 46);
   }
 
+  SECTION("time_to_index, uniform and non-uniform slicings")
+  {
+    Tube x(Interval(0.,125.), 0.125);
+    CHECK(x.nb_slices() == 1000);
+
+    for(int k = 0 ; k < 2 ; k++)
+    {
+      for(int i = 0 ; i < x.nb_slices() ; i++)
+      {
+        const Slice *s = x.slice(i);
+        CHECK(x.time_to_index(s->tdomain().lb()) == i);
+        CHECK(x.time_to_index(s->tdomain().mid()) == i);
+        CHECK(x.slice(s->tdomain().mid()) == s);
+      }
+
+      CHECK(x.time_to_index(125.) == x.nb_slices() - 1);
+      x.sample(42.06); // non-uniform slicing for the second iteration
+    }
+
+    CHECK(x.nb_slices() == 1001);
+    CHECK(x.time_to_index(42.) == 336);
+    CHECK(x.time_to_index(42.06) == 337);
+    CHECK(x.time_to_index(42.125) == 338);
+
+    x.remove_gate(42.06); // back to a uniform slicing
+    CHECK(x.nb_slices() == 1000);
+    CHECK(x.time_to_index(42.06) == 336);
+    CHECK(x.time_to_index(124.9) == 999);
+  }
+
   SECTION("index")
   {
     Tube tube = tube_test_1();
@@ -55,6 +89,32 @@ TEST_CASE("time_to_index")
     CHECK(tube.index(tube.first_slice()) == 0);
     CHECK(tube.index(tube.last_slice()) == 45);
   }
+
+  SECTION("index after structural changes")
+  {
+    Tube x(Interval(0.,10.), 1.);
+    Tube y(Interval(0.,10.), 1.);
+    CHECK(x.index(y.slice(2)) == -1);
+
+    x.sample(2.5);
+    CHECK(x.nb_slices() == 11);
+    CHECK(x.slice(3)->tdomain() == Interval(2.5,3.));
+    CHECK(x.index(x.slice(3)) == 3);
+    CHECK(x.slice(3)->prev_slice() == x.slice(2));
+    CHECK(x.last_slice() == x.slice(10));
+
+    x.remove_gate(2.5);
+    CHECK(x.nb_slices() == 10);
+    CHECK(x.slice(2)->tdomain() == Interval(2.,3.));
+    CHECK(x.slice(3)->tdomain() == Interval(3.,4.));
+    CHECK(x.index(x.slice(3)) == 3);
+
+    x.truncate_tdomain(Interval(2.5,6.5));
+    CHECK(x.nb_slices() == 5);
+    CHECK(x.first_slice()->tdomain() == Interval(2.5,3.));
+    CHECK(x.last_slice()->tdomain() == Interval(6.,6.5));
+    CHECK(x.index(x.last_slice()) == 4);
+  }
 }
 
 TEST_CASE("Tube slices structure")
@@ -403,3 +463,355 @@ TEST_CASE("Tube slices structure")
     CHECK(tube[0].slice(0)->tdomain() == Interval(8.2,8.3));
   }
 }
+
+TEST_CASE("Synthesis tree and slices structure")
+{
+  SECTION("Local updates of the tree on sample and remove_gate")
+  {
+    Tube x(Interval(0.,10.), 1.), y(x);
+    for(int i = 0 ; i < x.nb_slices() ; i++)
+    {
+      x.set(Interval(-1.,1.) + i, i);
+      y.set(Interval(-1.,1.) + i, i);
+    }
+
+    x.enable_synthesis(true);
+
+    // Many gates in the same area, in order to unbalance the tree
+    for(int i = 1 ; i < 50 ; i++)
+    {
+      double t = 3. + 1./(i+1.);
+      x.sample(t, Interval(-0.5,0.5) + t);
+      y.sample(t, Interval(-0.5,0.5) + t);
+    }
+
+    x.remove_gate(3.25);
+    y.remove_gate(3.25);
+    x.remove_gate(3.5);
+    y.remove_gate(3.5);
+
+    CHECK(x.nb_slices() == y.nb_slices());
+    CHECK(x == y);
+    CHECK(x.codomain() == y.codomain());
+
+    Tube z(y); // tree built from scratch
+    z.enable_synthesis(true);
+
+    for(int i = 0 ; i < x.nb_slices() ; i++)
+    {
+      const Interval t = x.slice(i)->tdomain();
+      CHECK(x.time_to_index(t.mid()) == i);
+      CHECK(x(t) == y(t));
+      CHECK(x(Interval(2.,t.ub())) == y(Interval(2.,t.ub())));
+      CHECK(ApproxIntv(x.integral(t.mid())) == z.integral(t.mid()));
+    }
+
+    CHECK(x.invert(Interval(3.1,3.2)) == y.invert(Interval(3.1,3.2)));
+  }
+}
+
+TEST_CASE("Tube snapshots")
+{
+  SECTION("Copy-on-write of modified chunks")
+  {
+    Tube x(Interval(0.,10.), 1./64., Interval(-1.,1.));
+    Tube x_ref(x);
+    CHECK(x.nb_slices() == 640);
+
+    TubeSnapshot snap(x);
+    CHECK(snap.nb_slices() == 640);
+    CHECK(snap.tdomain() == Interval(0.,10.));
+    CHECK(snap.nb_copied_chunks() == 0);
+    CHECK(snap.volume() == x.volume());
+
+    x.slice(10)->set(Interval(3.));
+    CHECK(snap.nb_copied_chunks() == 1);
+    CHECK(x(10) == Interval(3.));
+    CHECK(snap(10) == Interval(-1.,1.));
+    CHECK(snap.gate(10) == Interval(-1.,1.));
+    CHECK(snap.slice_tdomain(10) == x.slice_tdomain(10));
+
+    // Gate shared by two chunks
+    x.slice(2*TubeSnapshot::s_chunk_size)->set_input_gate(Interval(0.));
+    CHECK(snap.nb_copied_chunks() == 3);
+    CHECK(snap.gate(2*TubeSnapshot::s_chunk_size) == Interval(-1.,1.));
+    CHECK(snap(639) == Interval(-1.,1.));
+    CHECK(snap.gate(640) == Interval(-1.,1.));
+
+    snap.restore(x);
+    CHECK(x == x_ref);
+    CHECK(snap.nb_copied_chunks() == 0);
+
+    x.set(Interval(5.));
+    CHECK(snap.nb_copied_chunks() == 5);
+    CHECK(snap.volume() == x_ref.volume());
+
+    Tube z(x);
+    snap.restore(z);
+    CHECK(z == x_ref);
+    CHECK(x.codomain() == Interval(5.));
+  }
+
+  SECTION("Snapshots detached on structural changes")
+  {
+    TubeSnapshot *snap = NULL;
+
+    {
+      Tube x(Interval(0.,10.), 1., Interval(-1.,1.));
+      snap = new TubeSnapshot(x);
+      x.sample(5.5);
+      CHECK(snap->nb_copied_chunks() == 1);
+      x.set(Interval(2.));
+      CHECK(x.nb_slices() == 11);
+
+      TubeSnapshot snap2(x);
+      x.set(Interval(4.), 3); // existing gate
+      CHECK(snap2.gate(3) == Interval(2.));
+      CHECK(snap2.nb_copied_chunks() == 1);
+    } // x is destroyed
+
+    CHECK(snap->nb_slices() == 10);
+    CHECK((*snap)(5) == Interval(-1.,1.));
+    CHECK(snap->volume() == 20.);
+    delete snap;
+  }
+
+  SECTION("Snapshots following moved slices")
+  {
+    Tube x(Interval(0.,10.), 1./64., Interval(-1.,1.));
+    Tube y(Interval(0.,1.), 0.5, Interval(2.,3.));
+    TubeSnapshot snap_x(x), snap_y(y);
+
+    y = std::move(x); // contents exchanged, no chunk copied
+    CHECK(snap_x.nb_copied_chunks() == 0);
+    CHECK(snap_y.nb_copied_chunks() == 0);
+    CHECK(y.nb_slices() == 640);
+    CHECK(x.nb_slices() == 2);
+
+    y.slice(10)->set(Interval(3.));
+    CHECK(snap_x.nb_copied_chunks() == 1);
+    CHECK(snap_x(10) == Interval(-1.,1.));
+    snap_x.restore(y);
+    CHECK(y(10) == Interval(-1.,1.));
+    CHECK(snap_x.nb_copied_chunks() == 0);
+
+    Tube z(std::move(y));
+    CHECK(y.nb_slices() == 0);
+    z.set(Interval(0.));
+    CHECK(snap_x.volume() == 20.);
+    CHECK(snap_y.volume() == 1.);
+  }
+}
+
+TEST_CASE("Bulk slicing")
+{
+  SECTION("Tube from a list of gate times")
+  {
+    vector<double> v_t({0.,1.,1.5,3.,4.});
+    Tube x(v_t, Interval(-1.,1.));
+    CHECK(x.tdomain() == Interval(0.,4.));
+    CHECK(x.nb_slices() == 4);
+    CHECK(x.slice_tdomain(2) == Interval(1.5,3.));
+    CHECK(x.codomain() == Interval(-1.,1.));
+    CHECK(x.time_to_index(3.2) == 3);
+
+    Tube y(v_t, {Interval(0.,2.),Interval(1.,3.),Interval(2.,4.),Interval(5.)});
+    CHECK(y == Tube({Interval(0.,1.),Interval(1.,1.5),Interval(1.5,3.),Interval(3.,4.)},
+                    {Interval(0.,2.),Interval(1.,3.),Interval(2.,4.),Interval(5.)}));
+    CHECK(y(1.) == Interval(1.,2.));
+    CHECK(y(3.).is_empty());
+
+    Tube z(v_t, {Interval(0.,2.),Interval(1.,3.),Interval(2.,4.),Interval(5.)},
+                {Interval(0.),Interval(1.5),Interval(2.5,10.),Interval(3.),Interval(5.)});
+    CHECK(z(0.) == Interval(0.));
+    CHECK(z(1.) == Interval(1.5));
+    CHECK(z(1.5) == Interval(2.5,3.));
+    CHECK(z(3.).is_empty());
+    CHECK(z(4.) == Interval(5.));
+  }
+
+  SECTION("Batch sampling")
+  {
+    Tube x(Interval(0.,10.), 1., Interval(-1.,1.));
+    x.set(Interval(0.5), 4); // existing gate
+    Tube y(x);
+
+    vector<double> v_t({0.,0.5,0.5,2.,2.25,2.75,4.,9.5,10.});
+    x.sample(v_t);
+    for(double t : v_t)
+      y.sample(t);
+
+    CHECK(x.nb_slices() == 14);
+    CHECK(x == y);
+    CHECK(x(4.) == Interval(0.5));
+    CHECK(x.slice(3)->tdomain() == Interval(2.,2.25));
+    CHECK(x.time_to_index(2.5) == 4);
+    CHECK(x.time_to_index(9.7) == 13);
+
+    Tube z(Interval(0.,10.), 0.5);
+    z.sample(x);
+    CHECK(z.nb_slices() == 22);
+    CHECK(z.gate_exists(2.25));
+    CHECK(z.gate_exists(2.75));
+  }
+}
+
+TEST_CASE("Adaptive slicing")
+{
+  SECTION("merge_similar_slices")
+  {
+    vector<double> v_t({0.,1.,2.,3.,4.,5.});
+    Tube x(v_t, {Interval(0.,1.),Interval(0.,1.1),Interval(0.,1.2),Interval(5.,6.),Interval(5.,6.)});
+    Tube y(x);
+    x.merge_similar_slices(0.15); // each slice is compared to the previous merged ones
+    CHECK(x.nb_slices() == 2);
+    CHECK(x.slice_tdomain(0) == Interval(0.,3.));
+    CHECK(x(0) == Interval(0.,1.2));
+    CHECK(x(1) == Interval(5.,6.));
+    CHECK(x.slice_tdomain(1) == Interval(3.,5.));
+
+    y.merge_similar_slices(0.05);
+    CHECK(y.nb_slices() == 4);
+  }
+
+  SECTION("Coarsening within a budget")
+  {
+    Tube x(Interval(0.,10.), 1., TFunction("t"));
+    Tube y(x);
+    x.set(Interval(-10.,10.), 4); // larger gap around slice 4
+    x.set(Interval(-10.,10.), 5);
+    x.adapt_slicing(4);
+    CHECK(x.nb_slices() == 4);
+    CHECK(x.codomain() == Interval(-10.,10.));
+    CHECK(x.tdomain() == Interval(0.,10.));
+    CHECK(x.slice(4.5)->codomain() == Interval(-10.,10.));
+    CHECK(y.is_subset(x));
+
+    y.adapt_slicing(10, 5.); // merging only
+    CHECK(y.nb_slices() == 2);
+  }
+
+  SECTION("Coarsening between merged slices")
+  {
+    Tube x(Interval(0.,6.), 1.);
+    x.set(Interval(0.,1.), 0);
+    x.set(Interval(0.3,1.3), 1); // merged with slice 0
+    x.set(Interval(0.6,1.6), 2); // closer to slice 1 than to [0,1.3]
+    x.set(Interval(0.9,1.9), 3); // merged with slice 2
+    x.set(Interval(10.,11.), 4);
+    x.set(Interval(10.5,11.5), 5);
+    x.adapt_slicing(3, 0.35);
+    CHECK(x.nb_slices() == 3);
+    CHECK(x.slice_tdomain(0) == Interval(0.,2.));
+    CHECK(x.slice_tdomain(1) == Interval(2.,4.));
+    CHECK(x.slice_tdomain(2) == Interval(4.,6.));
+    CHECK(x(2) == Interval(10.,11.5));
+  }
+
+  SECTION("Refining within a budget")
+  {
+    Tube x(Interval(0.,10.), 1., Interval(0.,1.));
+    x.slice(6)->set(Interval(0.,5.));
+    x.adapt_slicing(13);
+    CHECK(x.nb_slices() == 13);
+    CHECK(x.slice_tdomain(5) == Interval(5.,5.5));
+    CHECK(x.slice_tdomain(7) == Interval(6.,6.5));
+    CHECK(x.slice_tdomain(9) == Interval(7.,7.5));
+    CHECK(x.codomain() == Interval(0.,5.));
+
+    x.adapt_slicing(20, 0.1); // flat parts are merged, then bisected
+    CHECK(x.nb_slices() == 6);
+    CHECK(x.slice_tdomain(2) == Interval(6.,6.5));
+  }
+
+  SECTION("Refining before a contraction")
+  {
+    Tube x(Interval(0.,10.), 1., Interval(0.,1.));
+    x.slice(6)->set(Interval(0.,5.));
+    x.adapt_slicing(13);
+    CHECK(x.nb_slices() == 13);
+
+    // The halves keep the codomain of their parent
+    CHECK(x.slice_tdomain(6) == Interval(5.5,6.));
+    CHECK(x.slice_tdomain(7) == Interval(6.,6.5));
+    CHECK(x.slice_tdomain(8) == Interval(6.5,7.));
+    CHECK(x.slice(7)->codomain() == Interval(0.,5.));
+    CHECK(x.slice(8)->codomain() == Interval(0.,5.));
+
+    // Information is gained only once the tube is contracted
+    Tube v(x);
+    v.set(Interval(-1.,1.));
+    CtcDeriv ctc_deriv;
+    ctc_deriv.contract(x, v);
+    CHECK(x.nb_slices() == 13);
+    CHECK(x.slice(7)->codomain() == Interval(0.,1.5));
+    CHECK(x.slice(8)->codomain() == Interval(0.,1.5));
+    CHECK(x(6.5) == Interval(0.,1.5));
+  }
+}
+
+TEST_CASE("Sliding window tubes")
+{
+  SECTION("SlidingTube")
+  {
+    SlidingTube x(0., 0.5, 4, Interval(0.,1.));
+    vector<Interval> v_evicted;
+    x.set_eviction_callback([&v_evicted](const Slice& s) { v_evicted.push_back(s.codomain()); });
+
+    for(int i = 1 ; i < 4 ; i++)
+      x.push_slice(Interval(i,i+1));
+    CHECK(x.nb_slices() == 4);
+    CHECK(x.tdomain() == Interval(0.,2.));
+    CHECK(x(0.5) == Interval(1.)); // consistency of the gates
+    CHECK(v_evicted.empty());
+
+    const Slice *s0 = x.first_slice();
+    Slice *s = x.push_slice(Interval(4.,5.));
+    CHECK(s == s0); // memory of the evicted slice is reused
+    CHECK(x.nb_slices() == 4);
+    CHECK(x.tdomain() == Interval(0.5,2.5));
+    CHECK(x.first_slice()->input_gate() == Interval(1.));
+    CHECK(x(2.) == Interval(4.));
+    CHECK(x.time_to_index(2.1) == 3);
+    CHECK(v_evicted.size() == 1);
+    CHECK(v_evicted[0] == Interval(0.,1.));
+
+    for(int i = 0 ; i < 100 ; i++)
+      x.push_slice();
+    CHECK(x.nb_slices() == 4);
+    CHECK(x.tdomain() == Interval(50.5,52.5));
+    CHECK(v_evicted.size() == 101);
+    CHECK(v_evicted[3] == Interval(3.,4.));
+    CHECK(x.capacity() == 4);
+
+    // Slice index after many evictions (head offset and compactions)
+    for(int k = 0 ; k < x.nb_slices() ; k++)
+    {
+      CHECK(x.slice(k)->tdomain() == Interval(50.5 + 0.5*k, 51. + 0.5*k));
+      CHECK(x.index(x.slice(k)) == k);
+      CHECK(x.time_to_index(50.7 + 0.5*k) == k);
+    }
+    CHECK(x.last_slice() == x.slice(3));
+    CHECK(x.first_slice()->next_slice() == x.slice(1));
+  }
+
+  SECTION("SlidingTubeVector")
+  {
+    SlidingTubeVector x(0., 1., 3, IntervalVector(2, Interval(-1.,1.)));
+    int nb_evictions = 0;
+    x.set_eviction_callback([&nb_evictions](const vector<const Slice*>& v_slices) {
+      CHECK(v_slices.size() == 2);
+      CHECK(v_slices[1]->tdomain() == Interval(nb_evictions,nb_evictions+1));
+      nb_evictions++;
+    });
+
+    for(int i = 0 ; i < 10 ; i++)
+      x.push_slice(IntervalVector(2, Interval(i,i+1)));
+    CHECK(nb_evictions == 8);
+    CHECK(x.tdomain() == Interval(8.,11.));
+    CHECK(x.nb_slices() == 3);
+    CHECK(x[1](10.5) == Interval(9.,10.));
+    CHECK(x[0](9.) == Interval(8.));
+    CHECK(x.size() == 2);
+  }
+}
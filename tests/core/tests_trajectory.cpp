@@ -184,4 +184,183 @@ TEST_CASE("Trajectory base")
     CHECK(test1 == test2);
     CHECK(test1[0] == test2[0]);
   }
+
+  SECTION("Sampled values")
+  {
+    // Values set in chronological order
+    Trajectory x;
+    for(int i = 0 ; i <= 1000 ; i++)
+      x.set(std::sin(i * 0.01), i * 0.01);
+
+    CHECK(x.sampled_times().size() == 1001);
+    CHECK(x.sampled_values().size() == 1001);
+    CHECK(x.tdomain() == Interval(0.,10.));
+    CHECK(x(0.) == 0.);
+    CHECK(x(500 * 0.01) == std::sin(500 * 0.01));
+    CHECK(x(10.) == std::sin(10.));
+    CHECK(x(0.005) == Approx(std::sin(0.01) / 2.));
+    CHECK(x(Interval(1.,2.)).lb() == Approx(std::sin(1.)));
+    CHECK(x(Interval(1.,2.)).ub() == Approx(std::sin(1.57)));
+    CHECK(x(Interval(1.,2.)).contains(x(1.5)));
+
+    // Values set in any order
+    Trajectory y({ 3., 0., 2., 1. }, { 6., 0., 4., 2. });
+    CHECK(y.sampled_times() == vector<double>({ 0., 1., 2., 3. }));
+    CHECK(y.sampled_values() == vector<double>({ 0., 2., 4., 6. }));
+    CHECK(y.codomain() == Interval(0.,6.));
+    CHECK(y(0.5) == 1.);
+    CHECK(y(Interval(0.5,2.5)) == Interval(1.,5.));
+
+    y.set(-1., 1.5); // insertion
+    y.set(3., 3.); // existing key, bound of the codomain
+    CHECK(y.sampled_times() == vector<double>({ 0., 1., 1.5, 2., 3. }));
+    CHECK(y.codomain() == Interval(-1.,4.));
+
+    // Non-uniform sampling
+    Trajectory z;
+    for(int i = 0 ; i < 100 ; i++)
+      z.set(i, i * i);
+    CHECK(z(2500.) == 50.);
+    CHECK(z(2550.) == Approx(50. + 50./101.));
+    CHECK(z(Interval(2400.,2600.)).lb() == Approx(48. + 96./97.));
+    CHECK(z(Interval(2400.,2600.)).ub() == Approx(50. + 100./101.));
+
+    // Map view, updated after modifications
+    CHECK(y.sampled_map().size() == 5);
+    CHECK(y.sampled_map().at(1.5) == -1.);
+    y.set(5., 4.);
+    CHECK(y.sampled_map().size() == 6);
+    CHECK(y.sampled_map().at(4.) == 5.);
+    CHECK(Trajectory(y.sampled_map()) == y);
+  }
+
+  SECTION("Interval evaluations over long time ranges")
+  {
+    Trajectory x;
+    for(int i = 0 ; i <= 10000 ; i++)
+      x.set(std::sin(i * 0.001) + std::cos(i * 0.037), i * 0.001);
+
+    // Comparison with a scan of the values
+    for(int k = 0 ; k < 200 ; k++)
+    {
+      Interval t(k * 0.0471, k * 0.0471 + 0.001 * (k * 37 % 500));
+      t &= x.tdomain();
+
+      Interval hull = Interval(x(t.lb())) | x(t.ub());
+      for(size_t i = 0 ; i < x.sampled_times().size() ; i++)
+        if(t.contains(x.sampled_times()[i]))
+          hull |= x.sampled_values()[i];
+
+      CHECK(x(t) == hull);
+    }
+
+    // The evaluation is updated after a modification
+    CHECK(x(Interval(2.,8.)).ub() < 2.);
+    x.set(5., 3.3333);
+    CHECK(x(Interval(2.,8.)).ub() == 5.);
+    CHECK(x(Interval(3.4,8.)).ub() < 2.);
+  }
+
+  SECTION("Shared time keys")
+  {
+    TrajectoryVector x(3);
+    for(int i = 0 ; i <= 1000 ; i++)
+    {
+      double t = i * 0.01;
+      x.set(Vector({std::cos(t), std::sin(t), t}), t);
+    }
+
+    CHECK(x.shares_sampled_times());
+    CHECK(&x[0].sampled_times() == &x[2].sampled_times());
+    CHECK(x[1].codomain().is_subset(Interval(-1.,1.)));
+
+    // Evaluations, compared with the ones of the components
+    for(int k = 0 ; k < 50 ; k++)
+    {
+      double t = k * 0.1973;
+      Interval it = Interval(t, t + 0.531) & x.tdomain();
+      for(int i = 0 ; i < 3 ; i++)
+      {
+        CHECK(x(t)[i] == x[i](t));
+        CHECK(x(it)[i] == x[i](it));
+      }
+    }
+
+    // Values set out of order, or on existing keys
+    x.set(Vector({5.,6.,7.}), 2.345);
+    x.set(Vector({-5.,-6.,-7.}), 2.);
+    CHECK(x.shares_sampled_times());
+    CHECK(x[0].sampled_times().size() == 1002);
+    CHECK(x(2.345) == Vector({5.,6.,7.}));
+    CHECK(x(2.) == Vector({-5.,-6.,-7.}));
+    CHECK(x[2].codomain() == Interval(-7.,10.));
+
+    // Copy on write
+    TrajectoryVector y(x);
+    CHECK(&y[0].sampled_times() == &x[0].sampled_times());
+    y.set(Vector({1.,2.,3.}), 11.);
+    CHECK(y.shares_sampled_times());
+    CHECK(&y[0].sampled_times() != &x[0].sampled_times());
+    CHECK(x.tdomain() == Interval(0.,10.));
+    CHECK(y.tdomain() == Interval(0.,11.));
+    CHECK(x[0].sampled_times().size() == 1002);
+
+    y[1].set(0., 10.5);
+    CHECK_FALSE(y.shares_sampled_times());
+    CHECK(y[0].sampled_times().size() == 1003);
+    CHECK(y[1].sampled_times().size() == 1004);
+
+    // Results of operations on sampled trajectories
+    TrajectoryVector z = x + x;
+    CHECK(z.shares_sampled_times());
+    CHECK(&z[0].sampled_times() == &x[0].sampled_times());
+    CHECK(z(2.345) == Vector({10.,12.,14.}));
+
+    x.truncate_tdomain(Interval(1.,9.));
+    CHECK(x.shares_sampled_times());
+    CHECK(x.tdomain() == Interval(1.,9.));
+  }
+
+  SECTION("Streamed values")
+  {
+    Trajectory x, x_ref;
+    x.limit_history(100);
+
+    for(int i = 0 ; i < 1000 ; i++)
+    {
+      double t = i * 0.01, y = std::sin(t) + std::cos(3.*t);
+      x.set(y, t);
+      x_ref.set(y, t);
+
+      // Evaluations keep the index of the extrema up to date
+      if(i % 7 == 0 && i > 0)
+      {
+        Interval it(x.tdomain().lb() + 0.003, t);
+        CHECK(x(it) == x_ref(it));
+      }
+
+      CHECK(x.sampled_times().size() >= std::min(i + 1, 100));
+      CHECK(x.sampled_times().size() < 200);
+    }
+
+    CHECK(x.tdomain().ub() == x_ref.tdomain().ub());
+    CHECK(x.tdomain().lb() >= 8.);
+    CHECK(x.sampled_values().size() == x.sampled_times().size());
+    CHECK(x.codomain() == x_ref(x.tdomain()));
+    CHECK(x.sampled_map().size() == x.sampled_times().size());
+    CHECK(x.last_value() == x_ref.last_value());
+
+    // Vector case, with shared time keys
+    TrajectoryVector v(2);
+    v.limit_history(10);
+    for(int i = 0 ; i < 100 ; i++)
+      v.set(Vector({1. * i, -1. * i}), 1. * i);
+
+    CHECK(v.shares_sampled_times());
+    CHECK(v[0].sampled_times().size() >= 10);
+    CHECK(v[0].sampled_times().size() < 20);
+    CHECK(v.tdomain().ub() == 99.);
+    CHECK(v[1].codomain() == Interval(-99., -v.tdomain().lb()));
+    CHECK(v(v.tdomain()) == IntervalVector({{v.tdomain().lb(), 99.}, {-99., -v.tdomain().lb()}}));
+  }
 }
\ No newline at end of file
@@ -215,6 +215,49 @@ TEST_CASE("Tube values")
   }
 }
 
+TEST_CASE("Testing batch evaluations")
+{
+  SECTION("Tube")
+  {
+    Tube x = tube_test_1();
+    x.set(Interval(-4,2), 14);
+
+    vector<double> v_t({14.,3.5,0.,46.,-1.,14.,7.2,46.5,25.,13.9,0.5});
+    vector<Interval> v_y = x.eval_batch(v_t);
+    REQUIRE(v_y.size() == v_t.size());
+    for(size_t k = 0 ; k < v_t.size() ; k++)
+      CHECK(v_y[k] == x(v_t[k]));
+
+    vector<Interval> v_tdomains({Interval(7.1,19.8),Interval::EMPTY_SET,Interval(0.5,25.5),
+      Interval(5.),Interval(6.,9.),Interval(-1.,2.),Interval(14.),Interval(23.,24.),Interval(0.,46.)});
+    v_y = x.eval_batch(v_tdomains);
+    REQUIRE(v_y.size() == v_tdomains.size());
+    for(size_t k = 0 ; k < v_tdomains.size() ; k++)
+      CHECK(v_y[k] == x(v_tdomains[k]));
+    CHECK(v_y[1].is_empty());
+    CHECK(v_y[5] == Interval::ALL_REALS);
+
+    CHECK(x.eval_batch(vector<double>()).empty());
+  }
+
+  SECTION("TubeVector")
+  {
+    TubeVector x(2, tube_test_1());
+    x[1].set(Interval(-1,1), Interval(10,11));
+    x[1].sample(10.5);
+
+    vector<double> v_t({12.,0.,10.5,3.});
+    vector<IntervalVector> v_y = x.eval_batch(v_t);
+    for(size_t k = 0 ; k < v_t.size() ; k++)
+      CHECK(v_y[k] == x(v_t[k]));
+
+    vector<Interval> v_tdomains({Interval(10.,11.),Interval(2.,8.5),Interval(0.),Interval(9.5,20.)});
+    v_y = x.eval_batch(v_tdomains);
+    for(size_t k = 0 ; k < v_tdomains.size() ; k++)
+      CHECK(v_y[k] == x(v_tdomains[k]));
+  }
+}
+
 TEST_CASE("Testing enclosed bounds (x evaluations)")
 {
   SECTION("Test x1")
@@ -382,6 +425,84 @@ TEST_CASE("Testing set inversion")
     }
   }
 
+  SECTION("Inversions with the index, and its invalidation")
+  {
+    Tube x = tube_test_1();
+    x.set(Interval(-4,2), 14);
+
+    // Reference: inversion slice by slice
+    auto invert_ref = [](const Tube& x, const Interval& y, const Interval& t)
+    {
+      Interval invert = Interval::EMPTY_SET;
+      for(const Slice *s = x.first_slice() ; s != NULL ; s = s->next_slice())
+        if(s->tdomain().lb() < t.ub() && (s->tdomain() & t).diam() > 0.)
+          invert |= s->invert(y, t & s->tdomain());
+      return invert;
+    };
+
+    vector<Interval> v_y({Interval(0.),Interval(-7.),Interval(-20,-18),Interval(6.,7.),Interval(-10.5),Interval(3.,3.5)});
+    vector<Interval> v_tdomains({x.tdomain(),Interval(3.8,42.5),Interval(14.,17.),Interval(0.5,1.5),Interval(20.,46.)});
+
+    for(const Interval& y : v_y)
+      for(const Interval& t : v_tdomains)
+        CHECK(x.invert(y, t) == invert_ref(x, y, t));
+
+    auto invert_v_ref = [](const Tube& x, const Interval& y, const Interval& t)
+    {
+      vector<Interval> v_t;
+      Interval invert = Interval::EMPTY_SET;
+      for(const Slice *s = x.slice(t.lb()) ; s != NULL && s->tdomain().lb() <= t.ub() ; s = s->next_slice())
+      {
+        Interval local_invert = s->invert(y, t & s->tdomain());
+        if(local_invert.is_empty() && !invert.is_empty())
+        {
+          v_t.push_back(invert);
+          invert.set_empty();
+        }
+        else
+          invert |= local_invert;
+      }
+      if(!invert.is_empty())
+        v_t.push_back(invert);
+      return v_t;
+    };
+
+    v_tdomains.push_back(Interval(3.8,14.)); // upper bound on a gate
+    v_tdomains.push_back(Interval(2.,13.));
+    v_y.push_back(Interval(-4.,-1.));
+    v_y.push_back(Interval(1.,2.));
+
+    vector<Interval> v;
+    for(const Interval& y : v_y)
+      for(const Interval& t : v_tdomains)
+      {
+        x.invert(y, v, t);
+        CHECK(v == invert_v_ref(x, y, t));
+      }
+
+    x.invert(Interval(0.), v, Interval(3.8,42.5));
+    CHECK(v.size() == 3);
+
+    // The index is invalidated by writings on the slices
+    CHECK(x.invert(Interval(20.), x.tdomain()) == Interval::EMPTY_SET);
+    x.slice(30)->set(Interval(19.,21.));
+    CHECK(x.invert(Interval(20.), x.tdomain()) == Interval(30.,31.));
+    x.set(Interval(18.,22.), Interval(40.,41.));
+    CHECK(x.invert(Interval(20.), x.tdomain()) == Interval(30.,41.));
+    x.invert(Interval(20.), v, x.tdomain());
+    CHECK(v.size() == 2);
+
+    x.sample(30.5);
+    x.slice(30.7)->set(Interval(0.));
+    CHECK(x.invert(Interval(20.), x.tdomain()) == Interval(30.,41.));
+    CHECK(x.invert(Interval(20.), Interval(30.6,35.)) == Interval::EMPTY_SET);
+
+    Tube y(x); // copies do not share the index
+    y.set(Interval(20.));
+    CHECK(x.invert(Interval(20.), Interval(30.6,35.)) == Interval::EMPTY_SET);
+    CHECK(y.invert(Interval(20.), Interval(30.6,35.)) == Interval(30.6,35.));
+  }
+
   SECTION("Invert method with derivative")
   {
     Tube x(Interval(0., 5.), 1.0);
@@ -825,6 +946,80 @@ TEST_CASE("Testing volume()")
     CHECK_FALSE(bounded_tube.codomain().is_unbounded());
     CHECK(Approx(bounded_tube.volume()) == 20.);
   }
+
+  SECTION("Cached aggregates, and their invalidation")
+  {
+    Tube x(Interval(0.,10.), 1., Interval(0.,1.));
+    x.set(Interval(0.,2.), 10.);
+    CHECK(x.volume() == 10.);
+    CHECK(x.codomain() == Interval(0.,1.));
+    CHECK(x.max_diam() == 1.);
+    CHECK(x.sum_gates_diam() == 11.); // gates are bounded by the slices
+
+    // Writing on a slice
+    x.slice(3)->set_envelope(Interval(-1.,3.));
+    CHECK(x.volume() == 13.);
+    CHECK(x.codomain() == Interval(-1.,3.));
+    CHECK(x.max_diam() == 4.);
+    CHECK(x.sum_gates_diam() == 11.);
+
+    // Writing on a gate
+    x.set(Interval(0.5), 5.);
+    CHECK(x.sum_gates_diam() == 10.);
+
+    // Writing through the tube
+    x &= Interval(0.,0.5);
+    CHECK(x.volume() == 5.);
+    CHECK(x.codomain() == Interval(0.,0.5));
+    CHECK(x.max_diam() == 0.5);
+
+    // Change of slicing
+    x.sample(4.5);
+    CHECK(x.nb_slices() == 11);
+    CHECK(x.volume() == 5.);
+    CHECK(x.sum_gates_diam() == 5.5);
+    x.slice(4)->set_envelope(Interval::NEG_REALS);
+    CHECK(x.volume() == POS_INFINITY);
+    CHECK(x.max_diam() == POS_INFINITY);
+    CHECK(x.codomain() == Interval(NEG_INFINITY,0.5));
+
+    // Copy and move
+    Tube y(x);
+    CHECK(y.volume() == POS_INFINITY);
+    y.slice(4)->set_envelope(Interval(0.,0.5));
+    CHECK(y.volume() == 5.);
+    CHECK(x.volume() == POS_INFINITY);
+    x = std::move(y);
+    CHECK(x.volume() == 5.);
+    x.set(Interval(0.,1.));
+    CHECK(x.volume() == 10.);
+  }
+
+  SECTION("Aggregates updated by successive writings")
+  {
+    Tube x(Interval(0.,10.), 0.5, Interval(-1.,1.));
+    CHECK(x.volume() == 20.);
+
+    for(int k = 0 ; k < 200 ; k++)
+    {
+      Slice *s = x.slice(k % x.nb_slices());
+      double c = 0.1 * (k % 7);
+
+      if(k % 3 == 0)
+        s->set_envelope(Interval(-c,c) + (k % 5));
+      else if(k % 3 == 1)
+        s->set_input_gate(s->codomain().mid() + Interval(-0.1,0.1));
+      else
+        s->set_output_gate(k % 11 == 0 ? Interval::ALL_REALS : Interval(s->codomain().lb()));
+
+      // Reference values computed from scratch by a copy
+      Tube y(x);
+      CHECK(Approx(x.volume()) == y.volume());
+      CHECK(Approx(x.sum_gates_diam()) == y.sum_gates_diam());
+      CHECK(x.codomain() == y.codomain());
+      CHECK(x.max_diam() == y.max_diam());
+    }
+  }
 }
 
 TEST_CASE("Interpol")